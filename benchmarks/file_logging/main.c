@@ -0,0 +1,92 @@
+#include <logx.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void stdio_messages(logx_t *logger, int limit)
+{
+    LOGX_TIMER_AUTO(logger, "Stdio file logging timer");
+    for (int i = 0; i < limit; i++)
+    {
+        LOGX_DEBUG(logger, "This is log message number: %d", i + 1);
+    }
+}
+
+void uring_messages(logx_t *logger, int limit)
+{
+    LOGX_TIMER_AUTO(logger, "io_uring file logging timer");
+    for (int i = 0; i < limit; i++)
+    {
+        LOGX_DEBUG(logger, "This is log message number: %d", i + 1);
+    }
+    logx_flush(logger);
+}
+
+void mmap_messages(logx_t *logger, int limit)
+{
+    LOGX_TIMER_AUTO(logger, "Mmap file logging timer");
+    for (int i = 0; i < limit; i++)
+    {
+        LOGX_DEBUG(logger, "This is log message number: %d", i + 1);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int limit = 10000; // default limit
+
+    if (argc >= 2)
+    {
+        limit = atoi(argv[1]);
+        if (limit <= 0)
+        {
+            fprintf(stderr, "Invalid limit provided: %s\n", argv[1]);
+            fprintf(stderr, "Usage: %s <limit>\n", argv[0]);
+            return -1;
+        }
+    }
+
+    logx_t *logger = NULL;
+    if (logx_create(NULL, &logger) != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "Failed to create logger instance\n");
+        return -1;
+    }
+
+    // Only the timer results reach the console; the records go to the files
+    logx_set_console_logging_level(logger, LOGX_LEVEL_INFO);
+
+    LOGX_BANNER(logger, "Measuring time taken to write %d logs to a file", limit);
+
+    // Built-in file sink: fwrite + fflush per record
+    stdio_messages(logger, limit);
+
+    // Memory-mapped sink: memcpy per record
+    logx_disable_file_logging(logger);
+
+    logx_sink_t *mmap_sink        = NULL;
+    logx_mmap_sink_cfg_t mmap_cfg = {.path = "./logx_mmap.log", .level = LOGX_LEVEL_DEBUG};
+    if (logx_add_mmap_sink(logger, &mmap_cfg, &mmap_sink) != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "Failed to add mmap sink\n");
+        logx_destroy(logger);
+        return -1;
+    }
+
+    mmap_messages(logger, limit);
+
+    // io_uring sink: memcpy into a write slot, one queued write per batch
+    logx_remove_sink(logger, mmap_sink);
+
+    logx_uring_sink_cfg_t uring_cfg = {.path = "./logx_uring.log", .level = LOGX_LEVEL_DEBUG};
+    if (logx_add_uring_sink(logger, &uring_cfg, NULL) != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "Failed to add io_uring sink\n");
+        logx_destroy(logger);
+        return -1;
+    }
+
+    uring_messages(logger, limit);
+
+    logx_destroy(logger);
+    return 0;
+}
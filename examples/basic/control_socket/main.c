@@ -0,0 +1,50 @@
+/**
+ * @file main.c
+ * @brief Demonstrates live level and sink changes through the LogX control socket.
+ *
+ * While this program runs, talk to it from another terminal:
+ *   echo 'level worker console DEBUG' | socat - UNIX-CONNECT:/tmp/logx_control.sock
+ *   echo 'stats *'                    | socat - UNIX-CONNECT:/tmp/logx_control.sock
+ *   echo 'site off main.c'            | socat - UNIX-CONNECT:/tmp/logx_control.sock
+ *
+ * (`nc -U /tmp/logx_control.sock` works too.)
+ */
+
+#include <logx.h>
+#include <stdio.h>
+#include <unistd.h>
+
+int main(void)
+{
+    logx_cfg_t cfg             = {0};
+    cfg.name                   = "worker";
+    cfg.enable_console_logging = 1;
+    cfg.enable_file_logging    = 0;
+    cfg.enable_colored_logs    = 1;
+    cfg.use_tty_detection      = 1;
+    cfg.console_level          = LOGX_LEVEL_INFO;
+    cfg.ts_format              = LOGX_TS_FMT_LOCAL;
+
+    /* Serve the control protocol on this socket for as long as the logger lives */
+    cfg.control_socket_path = "/tmp/logx_control.sock";
+
+    logx_t *logger = NULL;
+    if (logx_create(&cfg, &logger) != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "Failed to create logger\n");
+        return -1;
+    }
+
+    LOGX_INFO(logger, "Control socket at %s - try 'help'", cfg.control_socket_path);
+
+    for (int i = 0; i < 60; i++)
+    {
+        LOGX_DEBUG(logger, "Tick %d (visible once the console level is DEBUG)", i);
+        if (i % 5 == 0)
+            LOGX_INFO(logger, "Still working, tick %d", i);
+        sleep(1);
+    }
+
+    logx_destroy(logger);
+    return 0;
+}
@@ -14,6 +14,10 @@ int main()
     while (1)
     {
         LOGX_INFO_FREQ(logger, 5, "This message will be logged at most once every 5 seconds");
+
+        /* Token bucket: 2 messages/s sustained, bursts of up to 3 */
+        for (int i = 0; i < 10; i++)
+            LOGX_WARN_RATE(logger, 2, 3, "Burst message %d", i);
         sleep(1);
     }
 
@@ -0,0 +1,63 @@
+/**
+ * @file main.c
+ * @brief Demonstrates multi-process logging through shared memory and a collector process.
+ *
+ * The parent creates the logger, which forks the `logx-collector` process, then
+ * forks a few workers that keep using the inherited logger. Each worker writes
+ * into its own ring; only the collector touches `logs/shm_prefork.log`.
+ */
+
+#include <logx.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define WORKERS 4
+
+int main(void)
+{
+    logx_cfg_t cfg             = {0};
+    cfg.name                   = "prefork";
+    cfg.file_path              = "logs/shm_prefork.log";
+    cfg.enable_console_logging = 0;
+    cfg.enable_file_logging    = 1;
+    cfg.file_level             = LOGX_LEVEL_DEBUG;
+    cfg.rotate.type            = LOGX_ROTATE_BY_SIZE;
+    cfg.rotate.size_mb         = 10;
+    cfg.rotate.max_backups     = 3;
+    cfg.ts_format              = LOGX_TS_FMT_LOCAL;
+
+    /* One ring per process in /dev/shm/logx_prefork; the collector writes the file */
+    cfg.shm_name      = "logx_prefork";
+    cfg.shm_ring_size = 256 * 1024;
+    cfg.shm_rings     = WORKERS + 1;
+
+    logx_t *logger = NULL;
+    if (logx_create(&cfg, &logger) != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "Failed to create logger\n");
+        return -1;
+    }
+
+    LOGX_INFO(logger, "Master %d starting %d workers", (int)getpid(), WORKERS);
+
+    for (int w = 0; w < WORKERS; w++)
+    {
+        if (fork() == 0)
+        {
+            for (int i = 0; i < 1000; i++)
+                LOGX_DEBUG(logger, "worker %d request %d", w, i);
+            logx_destroy(logger);
+            _exit(0);
+        }
+    }
+
+    while (wait(NULL) > 0)
+        ;
+
+    LOGX_INFO(logger, "All workers done");
+    logx_destroy(logger);
+
+    printf("Records are in %s once the collector has drained the rings\n", cfg.file_path);
+    return 0;
+}
@@ -59,6 +59,8 @@ int main(void)
     cfg.rotate.max_backups     = 3;
     cfg.print_config           = 1;
     cfg.ts_format              = LOGX_TS_FMT_LOCAL;
+    cfg.timer_level            = LOGX_LEVEL_INFO;
+    cfg.timer_resource_usage   = 1; /* also report CPU time, context switches, faults */
 
     if (logx_create(&cfg, &logger) != LOGX_ERR_SUCCESS)
     {
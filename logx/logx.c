@@ -13,8 +13,15 @@
 #include "logx.h"
 #include "logx_common.h"
 #include "logx_config.h"
+#include "logx_control.h"
+#include "logx_dedup.h"
 #include "logx_errorcodes.h"
+#include "logx_format.h"
+#include "logx_reload.h"
 #include "logx_rotation.h"
+#include "logx_scratch.h"
+#include "logx_shed.h"
+#include "logx_sink.h"
 #include "logx_string_maps.h"
 #include "logx_time.h"
 
@@ -133,7 +140,7 @@ logx_errorcodes_t logx_set_console_logging_level(logx_t *logger, logx_level_t le
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
 
     /* Sanity check */
-    if (!logger || !is_valid_logx_level(level))
+    if (!logger || is_valid_logx_level(level) != LOGX_ERR_SUCCESS)
     {
         eErr = LOGX_ERR_INVALID_ARG;
         goto END;
@@ -141,6 +148,7 @@ logx_errorcodes_t logx_set_console_logging_level(logx_t *logger, logx_level_t le
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.console_level = level;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -152,7 +160,7 @@ logx_errorcodes_t logx_set_file_logging_level(logx_t *logger, logx_level_t level
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
 
     /* Sanity check */
-    if (!logger || !is_valid_logx_level(level))
+    if (!logger || is_valid_logx_level(level) != LOGX_ERR_SUCCESS)
     {
         eErr = LOGX_ERR_INVALID_ARG;
         goto END;
@@ -160,13 +168,14 @@ logx_errorcodes_t logx_set_file_logging_level(logx_t *logger, logx_level_t level
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.file_level = level;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
     return eErr;
 }
 
-logx_errorcodes_t logx_set_console_logging(logx_t *logger)
+logx_errorcodes_t logx_enable_console_logging(logx_t *logger)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
 
@@ -179,6 +188,7 @@ logx_errorcodes_t logx_set_console_logging(logx_t *logger)
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.enable_console_logging = 1;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -198,6 +208,7 @@ logx_errorcodes_t logx_disable_console_logging(logx_t *logger)
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.enable_console_logging = 0;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -218,15 +229,16 @@ logx_errorcodes_t logx_enable_file_logging(logx_t *logger)
     pthread_mutex_lock(&logger->lock);
     if (!logger->cfg.file_path)
     {
-        logger->cfg.enable_file_logging = 0;
-        eErr                            = LOGX_ERR_INVALID_LOGFILE_PATH;
+        __atomic_store_n(&logger->cfg.enable_file_logging, 0, __ATOMIC_RELAXED);
+        eErr = LOGX_ERR_INVALID_LOGFILE_PATH;
         pthread_mutex_unlock(&logger->lock);
         goto END;
     }
     else
     {
-        logger->cfg.enable_file_logging = 1;
+        __atomic_store_n(&logger->cfg.enable_file_logging, 1, __ATOMIC_RELAXED);
     }
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -245,7 +257,8 @@ logx_errorcodes_t logx_disable_file_logging(logx_t *logger)
     }
 
     pthread_mutex_lock(&logger->lock);
-    logger->cfg.enable_file_logging = 0;
+    __atomic_store_n(&logger->cfg.enable_file_logging, 0, __ATOMIC_RELAXED);
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -272,6 +285,7 @@ logx_errorcodes_t logx_enable_syslog(logx_t *logger)
         logger->syslog_opened = 1;
     }
     logger->cfg.enable_syslog = 1;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -290,6 +304,7 @@ logx_errorcodes_t logx_disable_syslog(logx_t *logger)
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.enable_syslog = 0;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -314,6 +329,47 @@ END:
     return eErr;
 }
 
+logx_errorcodes_t logx_set_max_message_size(logx_t *logger, int bytes)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger || bytes < 0)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.max_message_size, bytes, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&logger->lock);
+
+END:
+    return eErr;
+}
+
+logx_errorcodes_t logx_get_stats(logx_t *logger, logx_stats_t *out)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger || !out)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    out->records      = __atomic_load_n(&logger->stats.records, __ATOMIC_RELAXED);
+    out->bytes        = __atomic_load_n(&logger->stats.bytes, __ATOMIC_RELAXED);
+    out->shed         = __atomic_load_n(&logger->stats.shed, __ATOMIC_RELAXED);
+    out->collapsed    = __atomic_load_n(&logger->stats.collapsed, __ATOMIC_RELAXED);
+    out->truncated    = __atomic_load_n(&logger->stats.truncated, __ATOMIC_RELAXED);
+    out->write_errors = __atomic_load_n(&logger->stats.write_errors, __ATOMIC_RELAXED);
+
+END:
+    return eErr;
+}
+
 logx_errorcodes_t logx_enable_colored_logging(logx_t *logger)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
@@ -327,6 +383,7 @@ logx_errorcodes_t logx_enable_colored_logging(logx_t *logger)
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.enable_colored_logs = 1;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -346,6 +403,7 @@ logx_errorcodes_t logx_disable_colored_logging(logx_t *logger)
 
     pthread_mutex_lock(&logger->lock);
     logger->cfg.enable_colored_logs = 0;
+    logx_sinks_sync(logger);
     pthread_mutex_unlock(&logger->lock);
 
 END:
@@ -513,7 +571,7 @@ static logx_errorcodes_t logx_parse_yaml_config(const char *filepath, logx_cfg_t
     yaml_token_t token;
     bool parser_initialized = false;
 
-#define YAML_MAX_KEYS 32
+#define YAML_MAX_KEYS 48
     char keys[YAML_MAX_KEYS][128] = {{0}};
     char vals[YAML_MAX_KEYS][256] = {{0}};
     int pair_count                = 0;
@@ -541,7 +599,12 @@ static logx_errorcodes_t logx_parse_yaml_config(const char *filepath, logx_cfg_t
 
     while (1)
     {
-        yaml_parser_scan(&parser, &token);
+        if (!yaml_parser_scan(&parser, &token))
+        {
+            fprintf(stderr, "[LogX] YAML parse error in: %s\n", filepath);
+            eErr = LOGX_ERR_FAILURE;
+            goto END;
+        }
 
         if (token.type == YAML_STREAM_END_TOKEN)
         {
@@ -628,7 +691,7 @@ END:
  * @param[out] cfg      Structure to populate with parsed values.
  * @return `LOGX_ERR_SUCCESS` on success, error otherwise.
  */
-static logx_errorcodes_t logx_parse_config_file(const char *filepath, logx_cfg_t *cfg)
+logx_errorcodes_t logx_parse_config_file(const char *filepath, logx_cfg_t *cfg)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
 
@@ -659,6 +722,10 @@ static logx_errorcodes_t logx_parse_config_file(const char *filepath, logx_cfg_t
     {
         eErr = logx_parse_json_config(filepath, cfg);
     }
+    else
+    {
+        eErr = LOGX_ERR_INVALID_LOGFILE_PATH;
+    }
 
 END:
     return eErr;
@@ -671,12 +738,13 @@ END:
  * then `./logx_cfg.yml`, `./logx_cfg.yaml`, and `./logx_cfg.json`.
  * Returns a non-success code (and prints a message) if none are found.
  *
- * @param[out] cfg Structure to populate.
+ * @param[out] cfg  Structure to populate.
+ * @param[out] path Receives the path of the file that was found.
  * @return `LOGX_ERR_SUCCESS` if a file was found and parsed successfully.
  */
-static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg)
+static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg, const char **path)
 {
-    if (!cfg)
+    if (!cfg || !path)
         return LOGX_ERR_INVALID_ARG;
 
 #ifdef LOGX_CFG_FILEPATH
@@ -686,6 +754,7 @@ static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg)
         printf("[LogX] Found logger configuration file: %s. Trying to parse and set configuration "
                "...\n",
                LOGX_CFG_FILEPATH);
+        *path = LOGX_CFG_FILEPATH;
         return logx_parse_config_file(LOGX_CFG_FILEPATH, cfg);
     }
 #endif
@@ -697,6 +766,7 @@ static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg)
         printf("[LogX] Found logger configuration file: %s. Trying to parse and set configuration "
                "...\n",
                LOGX_DEFAULT_CFG_YML_FILEPATH);
+        *path = LOGX_DEFAULT_CFG_YML_FILEPATH;
         return logx_parse_config_file(LOGX_DEFAULT_CFG_YML_FILEPATH, cfg);
     }
 #endif
@@ -707,6 +777,7 @@ static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg)
         printf("[LogX] Found logger configuration file: %s. Trying to parse and set configuration "
                "...\n",
                LOGX_DEFAULT_CFG_YAML_FILEPATH);
+        *path = LOGX_DEFAULT_CFG_YAML_FILEPATH;
         return logx_parse_config_file(LOGX_DEFAULT_CFG_YAML_FILEPATH, cfg);
     }
 #endif
@@ -717,6 +788,7 @@ static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg)
         printf("[LogX] Found logger configuration file: %s. Trying to parse and set configuration "
                "...\n",
                LOGX_DEFAULT_CFG_JSON_FILEPATH);
+        *path = LOGX_DEFAULT_CFG_JSON_FILEPATH;
         return logx_parse_config_file(LOGX_DEFAULT_CFG_JSON_FILEPATH, cfg);
     }
 #endif
@@ -725,35 +797,13 @@ static logx_errorcodes_t logx_load_cfg_from_file(logx_cfg_t *cfg)
     return -1;
 }
 
-static int logx_level_to_syslog_priority(logx_level_t level)
-{
-    switch (level)
-    {
-        case LOGX_LEVEL_TRACE:
-            return LOG_DEBUG;
-        case LOGX_LEVEL_DEBUG:
-            return LOG_DEBUG;
-        case LOGX_LEVEL_BANNER:
-            return LOG_NOTICE;
-        case LOGX_LEVEL_INFO:
-            return LOG_INFO;
-        case LOGX_LEVEL_WARN:
-            return LOG_WARNING;
-        case LOGX_LEVEL_ERROR:
-            return LOG_ERR;
-        case LOGX_LEVEL_FATAL:
-            return LOG_CRIT;
-        default:
-            return LOG_DEBUG;
-    }
-}
-
 logx_errorcodes_t logx_create(const logx_cfg_t *cfg, logx_t **out)
 {
     logx_errorcodes_t eErr  = LOGX_ERR_SUCCESS;
     logx_cfg_t internal_cfg = {0};
     logx_t *l               = NULL;
     int strings_owned       = 0;
+    const char *cfg_src     = NULL;
 
     if (!out)
     {
@@ -770,9 +820,10 @@ logx_errorcodes_t logx_create(const logx_cfg_t *cfg, logx_t **out)
     {
         fprintf(stderr,
                 "[LogX] No configuration provided. Trying to load configuration from file...\n");
-        if (logx_load_cfg_from_file(&internal_cfg) < 0)
+        if (logx_load_cfg_from_file(&internal_cfg, &cfg_src) < 0)
         {
             fprintf(stderr, "[LogX] Setting default configuration...\n");
+            cfg_src = NULL;
             logx_set_default_cfg(&internal_cfg);
             logx_cfg_dup_strings(&internal_cfg); /* literals → heap */
         }
@@ -790,6 +841,8 @@ logx_errorcodes_t logx_create(const logx_cfg_t *cfg, logx_t **out)
     memcpy(&l->cfg, &internal_cfg, sizeof(l->cfg));
     strings_owned = 0; /* ownership transferred to l->cfg */
     pthread_mutex_init(&l->lock, NULL);
+    pthread_mutex_init(&l->timers.lock, NULL);
+    pthread_rwlock_init(&l->sinks.lock, NULL);
 
     l->fp              = NULL;
     l->fd              = -1;
@@ -802,21 +855,27 @@ logx_errorcodes_t logx_create(const logx_cfg_t *cfg, logx_t **out)
             fprintf(stderr, "[LogX] Failed to create path for logfile: %s",
                     logx_get_err_string(dir_err));
 
-        l->fp = fopen(l->cfg.file_path, "a");
-        if (!l->fp)
+        /* Multi-process mode: a collector process writes the file */
+        if (l->cfg.shm_name && *l->cfg.shm_name)
+        {
+            logx_errorcodes_t shm_err = logx_shm_attach(l);
+            if (shm_err != LOGX_ERR_SUCCESS)
+                fprintf(stderr, "[LogX] Shared memory %s unavailable (%s), writing %s directly\n",
+                        l->cfg.shm_name, logx_get_err_string(shm_err), l->cfg.file_path);
+        }
+
+        l->fp = l->shm ? NULL : fopen(l->cfg.file_path, "a");
+        if (!l->fp && !l->shm)
         {
             fprintf(stderr, "[LogX] Opening %s failed. Disabling file logging...\n",
                     l->cfg.file_path);
             l->cfg.enable_file_logging = 0;
         }
-        else
+        else if (l->fp)
         {
-            l->fd    = fileno(l->fp);
-            time_t t = time(NULL);
-            struct tm tm;
-            localtime_r(&t, &tm);
-            snprintf(l->current_date, sizeof(l->current_date), "%04d-%02d-%02d", tm.tm_year + 1900,
-                     tm.tm_mon + 1, tm.tm_mday);
+            l->fd = fileno(l->fp);
+            logx_rotation_today(l->current_date, sizeof(l->current_date));
+            logx_direct_start(l);
         }
     }
 
@@ -826,6 +885,29 @@ logx_errorcodes_t logx_create(const logx_cfg_t *cfg, logx_t **out)
             l->cfg.enable_colored_logs = 0;
     }
 
+    eErr = logx_layout_view_new(&l->view, l->cfg.layout_pattern, l->cfg.banner_pattern,
+                                l->cfg.name);
+    if (eErr != LOGX_ERR_SUCCESS)
+        goto END;
+
+    eErr = logx_sinks_init(l);
+    if (eErr != LOGX_ERR_SUCCESS)
+        goto END;
+
+    if (l->cfg.recorder_size > 0)
+    {
+        logx_errorcodes_t rec_err = logx_recorder_create(l);
+        if (rec_err != LOGX_ERR_SUCCESS)
+            fprintf(stderr, "[LogX] Flight recorder disabled: %s\n", logx_get_err_string(rec_err));
+    }
+
+    if (l->cfg.backfill_size > 0)
+    {
+        eErr = logx_backfill_init(&l->backfill, (size_t)l->cfg.backfill_size);
+        if (eErr != LOGX_ERR_SUCCESS)
+            goto END;
+    }
+
     if (l->cfg.print_config)
         logx_cfg_print((const logx_cfg_t *)&l->cfg);
 
@@ -837,6 +919,27 @@ logx_errorcodes_t logx_create(const logx_cfg_t *cfg, logx_t **out)
         l->syslog_opened = 1;
     }
 
+    if (l->cfg.control_socket_path && *l->cfg.control_socket_path)
+    {
+        logx_errorcodes_t ctl_err = logx_control_attach(l, l->cfg.control_socket_path);
+        if (ctl_err != LOGX_ERR_SUCCESS)
+            fprintf(stderr, "[LogX] Control socket %s unavailable: %s\n",
+                    l->cfg.control_socket_path, logx_get_err_string(ctl_err));
+        else
+            l->control_attached = 1;
+    }
+
+    if (cfg_src)
+        l->cfg_path = strdup(cfg_src);
+
+    if (l->cfg.watch_config)
+    {
+        logx_errorcodes_t watch_err = logx_watch_config(l, NULL);
+        if (watch_err != LOGX_ERR_SUCCESS)
+            fprintf(stderr, "[LogX] Not watching the configuration file: %s\n",
+                    logx_get_err_string(watch_err));
+    }
+
 END:
     if (eErr != LOGX_ERR_SUCCESS)
     {
@@ -844,6 +947,16 @@ END:
             logx_cfg_free_strings(&internal_cfg);
         if (l)
         {
+            logx_sinks_destroy(l);
+            logx_direct_stop(l);
+            logx_recorder_destroy(l);
+            logx_backfill_free(&l->backfill);
+            logx_shm_detach(l);
+            logx_layout_view_free(l->view);
+            if (l->fp)
+                fclose(l->fp);
+            pthread_rwlock_destroy(&l->sinks.lock);
+            pthread_mutex_destroy(&l->timers.lock);
             pthread_mutex_destroy(&l->lock);
             logx_cfg_free_strings(&l->cfg);
             free(l);
@@ -855,6 +968,9 @@ END:
     return eErr;
 }
 
+static void logx_emit_dedup_summary(logx_t *logger, logx_scratch_t *scratch, struct timeval *tv,
+                                    const logx_dedup_summary_t *summary);
+
 logx_errorcodes_t logx_destroy(logx_t *logger)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
@@ -865,8 +981,35 @@ logx_errorcodes_t logx_destroy(logx_t *logger)
         goto END;
     }
 
+    /* Detach first so that no control command or reload can reach a logger being torn down */
+    if (logger->control_attached)
+        logx_control_detach(logger);
+    logx_unwatch_config(logger);
+
     pthread_mutex_lock(&logger->lock);
 
+    /* Report anything the dedup stage is still holding back */
+    logx_dedup_summary_t summary;
+    logx_dedup_flush(&logger->dedup, &summary);
+    logx_scratch_t *scratch = summary.repeats ? logx_scratch_acquire() : NULL;
+    if (scratch)
+    {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        logx_emit_dedup_summary(logger, scratch, &tv, &summary);
+        logx_scratch_release(scratch);
+    }
+
+    pthread_rwlock_wrlock(&logger->sinks.lock);
+    logx_sinks_destroy(logger);
+    pthread_rwlock_unlock(&logger->sinks.lock);
+
+    logx_direct_stop(logger);
+    logx_recorder_destroy(logger);
+    logx_backfill_free(&logger->backfill);
+    logx_shm_detach(logger);
+    logx_layout_view_free(logger->view);
+
     if (logger->fp)
     {
         fflush(logger->fp);
@@ -876,179 +1019,593 @@ logx_errorcodes_t logx_destroy(logx_t *logger)
     }
 
     pthread_mutex_unlock(&logger->lock);
+    pthread_rwlock_destroy(&logger->sinks.lock);
+    pthread_mutex_destroy(&logger->timers.lock);
     pthread_mutex_destroy(&logger->lock);
 
     if (logger->syslog_opened)
         closelog();
 
     logx_cfg_free_strings(&logger->cfg);
+    free(logger->cfg_path);
     free(logger);
 
 END:
     return eErr;
 }
 
-static void logx_log_impl(logx_t *logger, logx_level_t level, uint32_t flags, const char *file,
-                          const char *func, int line, const char *fmt, va_list ap)
+/**
+ * @brief Append record annotations (rate limiter's suppressed count, sampling rate) to a payload.
+ *
+ * @param[in,out] payload Scratch buffer holding the message text.
+ * @param[in]     len     Length of the message text.
+ * @param[in]     annot   Annotations to append, or NULL.
+ */
+static void logx_append_annotations(logx_scratch_buf_t *payload, size_t len,
+                                    const logx_annot_t *annot)
 {
-    if (!logger || level == LOGX_LEVEL_OFF)
+    /* Both annotations with 20-digit numbers fit in 96 bytes */
+    if (!annot || !logx_scratch_reserve(payload, len + 96))
         return;
 
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
+    if (annot->suppressed)
+    {
+        snprintf(payload->data + len, payload->cap - len, " (%llu messages suppressed)",
+                 (unsigned long long)annot->suppressed);
+        len += strlen(payload->data + len);
+    }
 
-    pthread_mutex_lock(&logger->lock);
+    if (annot->sample_rate > 0.0)
+        snprintf(payload->data + len, payload->cap - len, " (sample_rate=%g)", annot->sample_rate);
+}
 
-    /* Check thresholds */
-    int write_console = logger->cfg.enable_console_logging && level >= logger->cfg.console_level;
-    int write_file =
-        logger->cfg.enable_file_logging && level >= logger->cfg.file_level && logger->fp;
-    int write_syslog = (flags & LOGX_FLAG_SYSLOG) && logger->cfg.enable_syslog;
+/**
+ * @brief Output buffer used while rendering a record, sized for it beforehand.
+ */
+typedef struct
+{
+    char *buf;  /**< Destination. */
+    size_t len; /**< Bytes written so far. */
+} logx_render_t;
+
+/** @brief Append `len` bytes to a render buffer. */
+static inline void render_put(logx_render_t *r, const char *s, size_t len)
+{
+    memcpy(r->buf + r->len, s, len);
+    r->len += len;
+}
+
+/** @brief Append `n` spaces to a render buffer. */
+static inline void render_pad(logx_render_t *r, size_t n)
+{
+    memset(r->buf + r->len, ' ', n);
+    r->len += n;
+}
 
-    if (!write_console && !write_file && !write_syslog)
+/**
+ * @brief Render one record in the given sink format.
+ *
+ * The size of the record is known up front, so the buffer is sized once and the
+ * pieces are copied in.
+ *
+ * @param[in]  format     Sink format.
+ * @param[in]  level      Record level.
+ * @param[in]  layout     Layout text of the record (see `logx_layout_render()`).
+ * @param[in]  span       Parts of `layout`.
+ * @param[in]  border     Banner border (banner records only).
+ * @param[in]  border_len Length of `border`.
+ * @param[in]  payload    Formatted message text.
+ * @param[in]  msg_len    Length of `payload`.
+ * @param[out] out        Scratch buffer that receives the record.
+ * @return Length of the rendered record, 0 if it cannot be rendered.
+ */
+static size_t logx_render_record(logx_sink_format_t format, logx_level_t level,
+                                 const char *layout, const logx_layout_span_t *span,
+                                 const char *border, size_t border_len, const char *payload,
+                                 size_t msg_len, logx_scratch_buf_t *out)
+{
+    const size_t prefix_len = 5;
+    const size_t gap_len    = span->msg_off;
+    const char *suffix      = layout + span->msg_off;
+    const size_t suffix_len = span->len - span->msg_off;
+    const char *color       = "";
+    const char *reset       = "";
+    size_t color_len        = 0;
+    size_t reset_len        = 0;
+    size_t need             = 0;
+    logx_render_t r         = {.buf = NULL, .len = 0};
+
+    if (format == LOGX_SINK_FORMAT_SYSLOG)
     {
-        pthread_mutex_unlock(&logger->lock);
-        return;
+        r.buf = logx_scratch_reserve(out, span->len - span->sys_off + msg_len + 1);
+        if (!r.buf)
+            return 0;
+        render_put(&r, layout + span->sys_off, gap_len - span->sys_off);
+        render_put(&r, payload, msg_len);
+        render_put(&r, suffix, suffix_len);
+        r.buf[r.len] = '\0';
+        return r.len;
     }
 
-    /* rotation check */
-    if (write_file)
-        check_and_rotate_log(logger);
+    if (format == LOGX_SINK_FORMAT_COLOR)
+    {
+        color     = logx_level_to_color(level);
+        reset     = COLOR_RESET;
+        color_len = strlen(color);
+        reset_len = sizeof(COLOR_RESET) - 1;
+    }
 
-    char ts[64];
-    get_timestamp(ts, sizeof(ts), &tv, logger->cfg.ts_format);
+    if (level == LOGX_LEVEL_BANNER)
+        need = 4 * (color_len + reset_len) + 3 * gap_len + 2 * border_len + prefix_len +
+               msg_len + suffix_len + 3;
+    else
+        need = 2 * (color_len + reset_len) + gap_len + msg_len + suffix_len + 1;
 
-    /* prepare message payload */
-    char payload[4096];
-    char linebuf[4096];
-    char border[4096 + 10]; // payload max + margins
-    vsnprintf(payload, sizeof(payload), fmt, ap);
+    r.buf = logx_scratch_reserve(out, need + 1);
+    if (!r.buf)
+        return 0;
 
-    int use_color = logger->cfg.enable_colored_logs;
-    const char *color;
+    render_put(&r, color, color_len);
+    render_put(&r, layout, gap_len);
+    render_put(&r, reset, reset_len);
 
-    /* Determine color code */
-    if (use_color)
+    if (level == LOGX_LEVEL_BANNER)
     {
-        color = logx_level_to_color(level);
+        render_put(&r, color, color_len);
+        render_put(&r, border, border_len);
+        render_put(&r, reset, reset_len);
+        render_put(&r, "\n", 1);
+        render_pad(&r, gap_len);
+        render_put(&r, color, color_len);
+        render_pad(&r, prefix_len);
+        render_put(&r, payload, msg_len);
+        render_put(&r, suffix, suffix_len);
+        render_put(&r, reset, reset_len);
+        render_put(&r, "\n", 1);
+        render_pad(&r, gap_len);
+        render_put(&r, color, color_len);
+        render_put(&r, border, border_len);
+        render_put(&r, reset, reset_len);
+        render_put(&r, "\n", 1);
     }
     else
     {
-        color = COLOR_RESET;
+        render_put(&r, color, color_len);
+        render_put(&r, payload, msg_len);
+        render_put(&r, suffix, suffix_len);
+        render_put(&r, reset, reset_len);
+        render_put(&r, "\n", 1);
     }
 
-    /* If it's a banner log, build the banner */
-    if (level == LOGX_LEVEL_BANNER)
+    r.buf[r.len] = '\0';
+    return r.len;
+}
+
+/**
+ * @brief Location text of a record: copied from the call site's slot, or formatted
+ *        into the scratch arena for a record without a site.
+ *
+ * @param[in,out] scratch Scratch arena of the log call.
+ * @param[in,out] site    Call site, or NULL.
+ * @param[in]     file    Call-site file.
+ * @param[in]     func    Call-site function.
+ * @param[in]     line    Call-site line.
+ * @param[out]    loc     Receives the location.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_NO_MEM` if the scratch buffer cannot grow.
+ */
+static logx_errorcodes_t logx_locate(logx_scratch_t *scratch, logx_callsite_t *site,
+                                     const char *file, const char *func, int line,
+                                     logx_callsite_loc_t *loc)
+{
+    logx_scratch_buf_t *buf = &scratch->location;
+    size_t need             = 0;
+
+    if (site && logx_callsite_loc(site, loc))
+        return LOGX_ERR_SUCCESS;
+
+    need = logx_callsite_loc_format(buf->data, buf->cap, file, func, line, loc);
+    if (need > buf->cap)
     {
-        const char *pattern = (logger->cfg.banner_pattern && *logger->cfg.banner_pattern)
-                                  ? logger->cfg.banner_pattern
-                                  : "=";
+        if (!logx_scratch_reserve(buf, need))
+            return LOGX_ERR_NO_MEM;
+        logx_callsite_loc_format(buf->data, buf->cap, file, func, line, loc);
+    }
+    return LOGX_ERR_SUCCESS;
+}
 
-        size_t msg_len     = strlen(payload);
-        size_t pattern_len = strlen(pattern);
+/**
+ * @brief Render one formatted record and hand it to every sink it qualifies for.
+ *
+ * The logger's layout is run once for the record inside a read section of its
+ * view, and with the sink list locked for reading the record is rendered at most
+ * once per sink format, into the calling thread's scratch arena; each sink takes
+ * its own lock to write it.
+ *
+ * @param[in]     logger  Logger instance.
+ * @param[in,out] scratch Scratch arena of the log call.
+ * @param[in]     level   Record level.
+ * @param[in]     flags   `LOGX_FLAG_*` bits of the record.
+ * @param[in]     tv      Wall-clock time of the record.
+ * @param[in]     tid     Thread that logged the record, 0 for the calling thread.
+ * @param[in,out] site    Call site, or NULL.
+ * @param[in]     file    Call-site file.
+ * @param[in]     func    Call-site function.
+ * @param[in]     line    Call-site line.
+ * @param[in]     payload Formatted message text (not inside `scratch`'s render buffers).
+ */
+static void logx_emit(logx_t *logger, logx_scratch_t *scratch, logx_level_t level, uint32_t flags,
+                      struct timeval *tv, unsigned long tid, logx_callsite_t *site,
+                      const char *file, const char *func, int line, const char *payload)
+{
+    int forced                  = (flags & LOGX_FLAG_FORCE) != 0;
+    int text_used               = 0;
+    int written                 = 0;
+    const char *border          = NULL;
+    size_t border_len           = 0;
+    size_t msg_len              = strlen(payload);
+    uint64_t now                = (uint64_t)tv->tv_sec * 1000ULL + (uint64_t)tv->tv_usec / 1000ULL;
+    const logx_layout_t *layout = NULL;
+    logx_layout_view_t *view    = NULL;
+    unsigned int bucket         = 0;
+    logx_layout_span_t span     = {0};
+    logx_sink_record_t rendered[LOGX_SINK_FORMAT_COUNT] = {{0}};
+
+    char ts[LOGX_LAYOUT_TS_SIZE];
+
+    logx_layout_fields_t fields = {
+        .ts    = ts,
+        .level = level,
+        .tid   = tid,
+    };
+
+    /* A reload frees the view it replaced only once every section that may use it has left */
+    bucket = logx_layout_guard_enter(&logger->view_guard);
+    view   = __atomic_load_n(&logger->view, __ATOMIC_ACQUIRE);
+    layout = &view->layout;
+
+    ts[0] = '\0';
+    if (layout->uses & LOGX_LAYOUT_USES_TS)
+        get_timestamp(ts, sizeof(ts), tv,
+                      __atomic_load_n(&logger->cfg.ts_format, __ATOMIC_RELAXED));
+    if (layout->uses & LOGX_LAYOUT_USES_SEQ)
+        fields.seq = __atomic_add_fetch(&logger->seq, 1, __ATOMIC_RELAXED);
+
+    if (((layout->uses & LOGX_LAYOUT_USES_LOC) &&
+         logx_locate(scratch, site, file, func, line, &fields.loc) != LOGX_ERR_SUCCESS) ||
+        logx_layout_render(layout, &scratch->prefix, &fields, &span) != LOGX_ERR_SUCCESS)
+    {
+        logx_layout_guard_leave(&logger->view_guard, bucket);
+        return;
+    }
 
-        /* --- border generation --- */
-        size_t border_len = (msg_len < sizeof(border) - 11) ? msg_len : sizeof(border) - 11;
+    if (level == LOGX_LEVEL_BANNER)
+    {
+        const char *pattern = view->banner;
+        size_t pattern_len  = strlen(pattern);
 
         // Add padding on both sides (5 chars each)
-        size_t padded_len = border_len + 10;
-        if (padded_len > sizeof(border) - 1)
-            padded_len = sizeof(border) - 1;
+        size_t padded_len = msg_len + 10;
+        char *out         = logx_scratch_reserve(&scratch->border, padded_len + 1);
 
-        for (size_t i = 0; i < padded_len; ++i)
-            border[i] = pattern[i % pattern_len];
+        if (out)
+        {
+            for (size_t j = 0; j < padded_len; ++j)
+                out[j] = pattern[j % pattern_len];
 
-        border[padded_len] = '\0';
+            out[padded_len] = '\0';
+            border          = out;
+            border_len      = padded_len;
+        }
     }
 
-    /* Prepare prefix */
-    int gap_len    = snprintf(linebuf, sizeof(linebuf), "[%s] [%s] [%s] (%s:%s:%d): ", ts,
-                              logx_level_to_string(level), logger->cfg.name, file ? file : "?",
-                           func ? func : "?", line);
-    int prefix_len = 5;
+    logx_layout_guard_leave(&logger->view_guard, bucket);
+
+    pthread_rwlock_rdlock(&logger->sinks.lock);
 
-    /* Console write */
-    if (write_console)
+    for (int i = 0; i < logger->sinks.count; i++)
     {
-        FILE *out = (level >= LOGX_LEVEL_WARN) ? stderr : stdout;
+        logx_sink_t *sink         = logger->sinks.list[i];
+        logx_sink_format_t format = __atomic_load_n(&sink->format, __ATOMIC_RELAXED);
+        logx_sink_record_t *rec   = &rendered[format];
+
+        if (!logx_sink_accepts(sink, level, flags, forced))
+            continue;
+
+        /* A banner whose border could not be built only goes to syslog */
+        if (level == LOGX_LEVEL_BANNER && !border && format != LOGX_SINK_FORMAT_SYSLOG)
+            continue;
 
-        if (use_color)
+        if (!rec->text)
         {
-            if (level == LOGX_LEVEL_BANNER)
-            {
-                fprintf(out, "%s%s%s", color, linebuf, COLOR_RESET);
-                fprintf(out, "%s%s%s\n", color, border, COLOR_RESET);
-                fprintf(out, "%*s", gap_len, "");
-                fprintf(out, "%s%*s%s%s\n", color, prefix_len, "", payload, COLOR_RESET);
-                fprintf(out, "%*s", gap_len, "");
-                fprintf(out, "%s%s%s\n", color, border, COLOR_RESET);
-            }
-            else
-            {
-                fprintf(out, "%s%s%s", color, linebuf, COLOR_RESET);
-                fprintf(out, "%s%s%s\n", color, payload, COLOR_RESET);
-            }
+            logx_scratch_buf_t *out = &scratch->render[format];
+
+            rec->len = logx_render_record(format, level, scratch->prefix.data, &span, border,
+                                          border_len, payload, msg_len, out);
+            if (!rec->len)
+                continue;
+
+            rec->level   = level;
+            rec->time_us = (uint64_t)tv->tv_sec * 1000000ULL + (uint64_t)tv->tv_usec;
+            rec->text    = out->data;
         }
+
+        logx_sink_push(sink, rec, now);
+        text_used |= format != LOGX_SINK_FORMAT_SYSLOG;
+        written = 1;
+    }
+
+    pthread_rwlock_unlock(&logger->sinks.lock);
+
+    if (!written)
+        return;
+
+    size_t bytes = text_used ? span.len + msg_len + 1 : rendered[LOGX_SINK_FORMAT_SYSLOG].len + 1;
+
+    __atomic_fetch_add(&logger->stats.records, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&logger->stats.bytes, bytes, __ATOMIC_RELAXED);
+    logx_shed_account_bytes(logger, bytes);
+}
+
+/**
+ * @brief Write a "last message repeated N times" record for the dedup stage.
+ *
+ * Must be called with the logger lock held.
+ *
+ * @param[in]     logger  Logger instance.
+ * @param[in,out] scratch Scratch arena of the log call.
+ * @param[in]     tv      Wall-clock time of the summary.
+ * @param[in]     summary Summary returned by the dedup stage; nothing is written if empty.
+ */
+static void logx_emit_dedup_summary(logx_t *logger, logx_scratch_t *scratch, struct timeval *tv,
+                                    const logx_dedup_summary_t *summary)
+{
+    char msg[64];
+
+    if (!summary->repeats)
+        return;
+
+    snprintf(msg, sizeof(msg), "last message repeated %llu times",
+             (unsigned long long)summary->repeats);
+    logx_emit(logger, scratch, summary->level, summary->flags, tv, 0, NULL, summary->file,
+              summary->func, summary->line, msg);
+}
+
+void logx_dedup_write_aged(logx_t *logger)
+{
+    int window_ms = __atomic_load_n(&logger->cfg.dedup_window_ms, __ATOMIC_RELAXED);
+    logx_dedup_summary_t summary;
+
+    if (window_ms <= 0)
+        return;
+
+    /* Never wait here: logx_destroy() stops this thread with the logger lock held */
+    if (pthread_mutex_trylock(&logger->lock) != 0)
+        return;
+
+    logx_dedup_take_aged(&logger->dedup, (uint64_t)window_ms * 1000000ULL, &summary);
+    logx_scratch_t *scratch = summary.repeats ? logx_scratch_acquire() : NULL;
+    if (scratch)
+    {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        logx_emit_dedup_summary(logger, scratch, &tv, &summary);
+        logx_scratch_release(scratch);
+    }
+
+    pthread_mutex_unlock(&logger->lock);
+}
+
+/**
+ * @brief Write every record held by the backfill ring, oldest first.
+ *
+ * Must be called with the logger lock held.
+ *
+ * @param[in]     logger  Logger instance.
+ * @param[in,out] scratch Scratch arena of the log call.
+ */
+static void logx_emit_backfill(logx_t *logger, logx_scratch_t *scratch)
+{
+    logx_backfill_record_t rec;
+
+    while (logx_backfill_pop(&logger->backfill, &rec))
+        logx_emit(logger, scratch, rec.level, rec.flags, &rec.tv, rec.tid, NULL, rec.file,
+                  rec.func, rec.line, rec.payload);
+}
+
+/**
+ * @brief Dump the flight recorder after a FATAL record. Called without the logger lock.
+ *
+ * @param[in] logger Logger instance.
+ * @param[in] level  Level of the record just logged.
+ * @param[in] record 1 if the record went into the flight recorder.
+ */
+static void logx_recorder_fatal(logx_t *logger, logx_level_t level, int record)
+{
+    if (record && level == LOGX_LEVEL_FATAL)
+        logx_recorder_dump(logger, "LOGX_FATAL");
+}
+
+/** @brief Ends a message cut at `max_message_size`; `%zu` is the number of bytes cut. */
+#define LOGX_TRUNCATION_MARKER "...[truncated %zu bytes]"
+
+/** @brief Room kept for the marker, with a 20-digit count and the NUL. */
+#define LOGX_TRUNCATION_ROOM 48
+
+/**
+ * @brief `vsnprintf()`, run from the parsed format of the call site when there is one.
+ */
+static int logx_vformat(const logx_format_t *parsed, char *buf, size_t size, const char *fmt,
+                        va_list ap)
+{
+    return parsed ? logx_format_vsnprintf(parsed, buf, size, ap) : vsnprintf(buf, size, fmt, ap);
+}
+
+/**
+ * @brief Format a message into the payload buffer of the scratch arena.
+ *
+ * The first pass formats into the buffer as it is, which is enough for most
+ * messages. A longer message is measured by that pass and formatted again into
+ * a buffer of the exact size. A message longer than `max_message_size` is cut
+ * and ends with `LOGX_TRUNCATION_MARKER`.
+ *
+ * @param[in]     logger  Logger instance.
+ * @param[in,out] payload Scratch buffer that receives the message.
+ * @param[out]    len     Length of the message.
+ * @param[in]     parsed  Parsed `fmt` of the call site, or NULL.
+ * @param[in]     fmt     printf-style format string.
+ * @param[in]     ap      Format arguments; consumed.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_NO_MEM` if the buffer cannot be allocated.
+ */
+static logx_errorcodes_t logx_format_payload(logx_t *logger, logx_scratch_buf_t *payload,
+                                             size_t *len, const logx_format_t *parsed,
+                                             const char *fmt, va_list ap)
+{
+    int limit    = __atomic_load_n(&logger->cfg.max_message_size, __ATOMIC_RELAXED);
+    size_t max   = limit > 0 ? (size_t)limit : (size_t)LOGX_DEFAULT_CFG_MAX_MESSAGE_SIZE;
+    size_t total = 0;
+    size_t n     = 0;
+    int ret      = 0;
+    va_list again;
+
+    if (!logx_scratch_reserve(payload, LOGX_SCRATCH_MIN_SIZE))
+        return LOGX_ERR_NO_MEM;
+
+    if (max < LOGX_MESSAGE_MIN_SIZE)
+        max = LOGX_MESSAGE_MIN_SIZE;
+
+    va_copy(again, ap);
+    ret   = logx_vformat(parsed, payload->data, payload->cap, fmt, ap);
+    total = ret > 0 ? (size_t)ret : 0;
+    n     = total < max ? total : max - LOGX_TRUNCATION_ROOM;
+
+    /* Second pass, only for a message the buffer was too small for */
+    if (n >= payload->cap)
+    {
+        if (logx_scratch_reserve(payload, n + 1))
+            logx_vformat(parsed, payload->data, n + 1, fmt, again);
         else
-        {
-            if (level == LOGX_LEVEL_BANNER)
-            {
-                fprintf(out, "%s", linebuf);
-                fprintf(out, "%s\n", border);
-                fprintf(out, "%*s", gap_len, "");
-                fprintf(out, "%*s%s\n", prefix_len, "", payload);
-                fprintf(out, "%*s", gap_len, "");
-                fprintf(out, "%s\n", border);
-            }
-            else
-            {
-                fprintf(out, "%s", linebuf);
-                fprintf(out, "%s\n", payload);
-            }
-        }
+            n = payload->cap - 1;
+    }
+    va_end(again);
+
+    if (n < total)
+    {
+        if (logx_scratch_reserve(payload, n + LOGX_TRUNCATION_ROOM))
+            snprintf(payload->data + n, LOGX_TRUNCATION_ROOM, LOGX_TRUNCATION_MARKER, total - n);
+        else
+            payload->data[n] = '\0';
+
+        n += strlen(payload->data + n);
+        __atomic_fetch_add(&logger->stats.truncated, 1, __ATOMIC_RELAXED);
+    }
+
+    *len = n;
+    return LOGX_ERR_SUCCESS;
+}
+
+static void logx_log_impl(logx_t *logger, logx_level_t level, uint32_t flags,
+                          const logx_annot_t *annot, logx_callsite_t *site, const char *file,
+                          const char *func, int line, const char *fmt, va_list ap)
+{
+    if (!logger || (unsigned)level >= LOGX_LEVEL_OFF)
+        return;
+
+    /* Check thresholds without a lock; nothing is formatted for a record nobody takes */
+    int forced = (flags & LOGX_FLAG_FORCE) != 0;
+    int record = logger->recorder &&
+                 level >= __atomic_load_n(&logger->cfg.recorder_level, __ATOMIC_RELAXED);
+    int wanted = logx_sinks_wanted(&logger->sinks, level, flags, forced);
+
+    if (!wanted && !record)
+        return;
+
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    if (!wanted)
+    {
+        /* The flight recorder keeps records no sink writes; format straight into it */
+        logx_recorder_vpush(logger->recorder, &tv, level, file, func, line, fmt, ap);
+        logx_recorder_fatal(logger, level, record);
+        return;
+    }
+
+    /* Adaptive load shedding — may raise the effective level while over budget */
+    logx_shed_report_t shed_report;
+    if (!logx_shed_admit(logger, level, &shed_report))
+    {
+        __atomic_fetch_add(&logger->stats.shed, 1, __ATOMIC_RELAXED);
+        if (record)
+            logx_recorder_vpush(logger->recorder, &tv, level, file, func, line, fmt, ap);
+        logx_shed_report(logger, &shed_report);
+        logx_recorder_fatal(logger, level, record);
+        return;
+    }
+
+    /* prepare message payload in the thread's scratch arena */
+    size_t len                  = 0;
+    logx_scratch_t *scratch     = logx_scratch_acquire();
+    const logx_format_t *parsed = NULL;
+
+    /* A literal format is parsed once per call site and then run from the parsed specs */
+    if (site && (flags & LOGX_FLAG_FMT_LITERAL))
+        parsed = logx_format_site(site, fmt);
+    flags &= ~LOGX_FLAG_FMT_LITERAL;
+
+    if (!scratch || logx_format_payload(logger, &scratch->payload, &len, parsed, fmt, ap))
+        goto END;
+    logx_append_annotations(&scratch->payload, len, annot);
+
+    const char *payload = scratch->payload.data;
+
+    if (record)
+        logx_recorder_push(logger->recorder, &tv, level, file, func, line, payload);
 
-        // fflush(out);
+    /* Backfill — low-level records wait in the ring until a trigger record arrives */
+    if (logger->backfill.buf && !forced &&
+        level < __atomic_load_n(&logger->cfg.backfill_level, __ATOMIC_RELAXED))
+    {
+        pthread_mutex_lock(&logger->lock);
+        logx_backfill_push(&logger->backfill, &tv, level, flags, file, func, line, payload);
+        pthread_mutex_unlock(&logger->lock);
+        goto END;
     }
 
-    /* File write */
-    if (write_file)
+    /* Repeated-message deduplication — collapse consecutive identical records */
+    int dedup_window_ms = __atomic_load_n(&logger->cfg.dedup_window_ms, __ATOMIC_RELAXED);
+    if (dedup_window_ms > 0)
     {
-        if (logger->fd >= 0)
-            exclusive_flock(logger->fd);
+        logx_dedup_summary_t summary;
+
+        pthread_mutex_lock(&logger->lock);
+        int write = logx_dedup_check(&logger->dedup, (uint64_t)dedup_window_ms * 1000000ULL, level,
+                                     flags, file, func, line, fmt, payload, &summary);
+
+        /* Under the lock, so the summary stays ahead of the records that follow it */
+        logx_emit_dedup_summary(logger, scratch, &tv, &summary);
+        pthread_mutex_unlock(&logger->lock);
 
-        if (logger->fp)
+        if (!write)
         {
-            if (level == LOGX_LEVEL_BANNER)
-            {
-                fprintf(logger->fp, "%s", linebuf);
-                fprintf(logger->fp, "%s\n", border);
-                fprintf(logger->fp, "%*s", gap_len, "");
-                fprintf(logger->fp, "%*s%s\n", prefix_len, "", payload);
-                fprintf(logger->fp, "%*s", gap_len, "");
-                fprintf(logger->fp, "%s\n", border);
-            }
-            else
-            {
-                fprintf(logger->fp, "%s", linebuf);
-                fprintf(logger->fp, "%s\n", payload);
-            }
-            fflush(logger->fp);
+            __atomic_fetch_add(&logger->stats.collapsed, 1, __ATOMIC_RELAXED);
+            goto END;
         }
-
-        if (logger->fd >= 0)
-            unlock_flock(logger->fd);
     }
 
-    /* Syslog write — send logger name + source location + message; syslog adds its own timestamp */
-    if (write_syslog)
+    if (logger->backfill.buf &&
+        level >= __atomic_load_n(&logger->cfg.backfill_trigger_level, __ATOMIC_RELAXED))
     {
-        char syslog_msg[8192];
-        snprintf(syslog_msg, sizeof(syslog_msg), "[%s] (%s:%s:%d): %s", logger->cfg.name,
-                 file ? file : "?", func ? func : "?", line, payload);
-        syslog(logx_level_to_syslog_priority(level), "%s", syslog_msg);
+        pthread_mutex_lock(&logger->lock);
+        logx_emit_backfill(logger, scratch);
+        pthread_mutex_unlock(&logger->lock);
     }
 
-    pthread_mutex_unlock(&logger->lock);
+    logx_emit(logger, scratch, level, flags, &tv, 0, site, file, func, line, payload);
+
+END:
+    logx_scratch_release(scratch);
+    logx_shed_report(logger, &shed_report);
+    logx_recorder_fatal(logger, level, record);
 }
 
 void logx_log(logx_t *logger, logx_level_t level, const char *file, const char *func, int line,
@@ -1056,7 +1613,7 @@ void logx_log(logx_t *logger, logx_level_t level, const char *file, const char *
 {
     va_list ap;
     va_start(ap, fmt);
-    logx_log_impl(logger, level, 0, file, func, line, fmt, ap);
+    logx_log_impl(logger, level, 0, NULL, NULL, file, func, line, fmt, ap);
     va_end(ap);
 }
 
@@ -1065,6 +1622,37 @@ void logx_log_f(logx_t *logger, logx_level_t level, uint32_t flags, const char *
 {
     va_list ap;
     va_start(ap, fmt);
-    logx_log_impl(logger, level, flags, file, func, line, fmt, ap);
+    logx_log_impl(logger, level, flags, NULL, NULL, file, func, line, fmt, ap);
+    va_end(ap);
+}
+
+void logx_log_ex(logx_t *logger, logx_level_t level, uint32_t flags, const logx_annot_t *annot,
+                 const char *file, const char *func, int line, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    logx_log_impl(logger, level, flags, annot, NULL, file, func, line, fmt, ap);
+    va_end(ap);
+}
+
+void logx_log_site(logx_t *logger, uint32_t flags, const logx_annot_t *annot,
+                   logx_callsite_t *site, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    logx_log_impl(logger, site->level, flags, annot, site, site->file, site->func, site->line,
+                  fmt, ap);
     va_end(ap);
 }
+
+int logx_level_enabled(logx_t *logger, logx_level_t level, uint32_t flags)
+{
+    if (!logger || (unsigned)level >= LOGX_LEVEL_OFF)
+        return 0;
+
+    /* Same lock-free thresholds logx_log_impl() checks before formatting */
+    if (logger->recorder &&
+        level >= __atomic_load_n(&logger->cfg.recorder_level, __ATOMIC_RELAXED))
+        return 1;
+    return logx_sinks_wanted(&logger->sinks, level, flags, (flags & LOGX_FLAG_FORCE) != 0);
+}
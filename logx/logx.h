@@ -15,9 +15,23 @@
 #ifndef _LOGX_H
 #define _LOGX_H
 
+#include "logx_backfill.h"
+#include "logx_callsite.h"
+#include "logx_dedup.h"
+#include "logx_direct.h"
+#include "logx_layout.h"
+#include "logx_mmap.h"
+#include "logx_ratelimit.h"
+#include "logx_recorder.h"
+#include "logx_reload.h"
 #include "logx_rotation.h"
+#include "logx_sample.h"
+#include "logx_shed.h"
+#include "logx_shm.h"
+#include "logx_sink.h"
 #include "logx_time.h"
 #include "logx_types.h"
+#include "logx_uring.h"
 #include "version.h"
 
 #include <pthread.h>
@@ -34,6 +48,12 @@
 /** @brief Per-call flag for logx_log_f(): route this message to syslog. Combine with OR. */
 #define LOGX_FLAG_SYSLOG (1U << 0)
 
+/** @brief Per-call flag for logx_log_f(): ignore the console/file level thresholds. */
+#define LOGX_FLAG_FORCE (1U << 1)
+
+/** @brief Internal per-call flag: `fmt` is a string literal, so its parsed form can be cached. */
+#define LOGX_FLAG_FMT_LITERAL (1U << 2)
+
 /**
  * @brief Syslog facility codes.
  *
@@ -54,6 +74,32 @@ typedef enum
     LOGX_SYSLOG_FACILITY_LOCAL7 = LOG_LOCAL7, /**< Local use 7. */
 } logx_syslog_facility_t;
 
+/**
+ * @brief Per-record annotations appended to the message text.
+ * @internal
+ *
+ * Filled in by the rate-limiting and sampling macros and passed to `logx_log_ex()`.
+ * Zero-initialise and set only the members you need.
+ */
+typedef struct
+{
+    uint64_t suppressed; /**< Messages dropped at this call site since the last emitted one. */
+    double sample_rate;  /**< Fraction of calls kept by sampling (0 = not sampled). */
+} logx_annot_t;
+
+/**
+ * @brief Per-logger counters, as returned by `logx_get_stats()`.
+ */
+typedef struct
+{
+    uint64_t records;      /**< Records written to at least one sink. */
+    uint64_t bytes;        /**< Bytes of rendered records written. */
+    uint64_t shed;         /**< Records dropped by adaptive load shedding. */
+    uint64_t collapsed;    /**< Records collapsed by repeated-message deduplication. */
+    uint64_t truncated;    /**< Messages cut at `max_message_size`. */
+    uint64_t write_errors; /**< Sink `write_batch` or `flush` calls that failed. */
+} logx_stats_t;
+
 /**
  * @brief Logger configuration structure.
  *
@@ -81,6 +127,27 @@ struct logx_cfg_t
     int enable_syslog;          /**< 1 = also route log messages to syslog. */
     logx_syslog_facility_t syslog_facility; /**< syslog facility (default LOGX_SYSLOG_FACILITY_USER). */
     const char *syslog_ident;               /**< syslog identity string (NULL = logger name). */
+    logx_level_t timer_level; /**< Level at which `logx_timer_stop()` results are logged. */
+    int timer_resource_usage; /**< 1 = timers also report thread CPU time and rusage deltas. */
+    int shed_records_per_sec; /**< Load-shedding budget in records/s (0 = no record budget). */
+    int shed_bytes_per_sec;   /**< Load-shedding budget in bytes/s (0 = no byte budget). */
+    int dedup_window_ms;      /**< Collapse repeated records within this window (0 = off). */
+    const char *control_socket_path; /**< Unix socket for the control thread (NULL = off). */
+    int watch_config;                /**< 1 = reload when the loaded config file changes. */
+    int file_buffer_size;            /**< Bytes the file sink batches (0 = none). */
+    int file_direct_io;              /**< 1 = write the log file with O_DIRECT (no page cache). */
+    int file_atomic_append;          /**< 1 = one O_APPEND write per record batch, no flock. */
+    int recorder_size;               /**< Bytes of the crash flight-recorder ring (0 = off). */
+    logx_level_t recorder_level;     /**< Minimum level kept by the flight recorder. */
+    const char *recorder_path;       /**< Flight-recorder dump file (NULL = `<file_path>.crash`). */
+    int backfill_size;               /**< Bytes of the backfill ring (0 = off). */
+    logx_level_t backfill_level;     /**< Records below this level wait for a trigger. */
+    logx_level_t backfill_trigger_level; /**< Records at/above this level write the held ones. */
+    const char *shm_name;            /**< Shared memory object for multi-process logging. */
+    int shm_ring_size;               /**< Bytes of each process's shared-memory ring. */
+    int shm_rings;                   /**< Number of rings (processes) in the segment. */
+    int max_message_size;            /**< Longest message in bytes, marker included (0 = 1 MiB). */
+    const char *layout_pattern;      /**< Record layout, e.g. `"%T %L %n %m"` (NULL = default). */
 };
 
 /**
@@ -88,17 +155,37 @@ struct logx_cfg_t
  *
  * Obtain via `logx_create()`. All fields are managed internally; do not access
  * them directly — use the public API functions instead.
+ *
+ * `lock` serializes configuration changes and the dedup and backfill stages,
+ * `timers.lock` the timers, `sinks.lock` the sink list, and every sink has a lock
+ * for its own output. They are taken in that order: `lock`, `sinks.lock`, a sink's
+ * lock. Messages are formatted before any of them is taken, and the settings the
+ * logging path needs are read without a lock. The layout is read through `view`
+ * inside a `view_guard` read section instead of a lock.
  */
 struct logx_t
 {
     logx_cfg_t cfg;        /**< Active configuration (owned copy). */
-    FILE *fp;              /**< Open log-file handle, or NULL. */
-    int fd;                /**< File descriptor for flock/fstat. */
-    pthread_mutex_t lock;  /**< Mutex that protects all mutable state. */
+    FILE *fp;              /**< Open log-file handle, or NULL (file sink lock). */
+    int fd;                /**< File descriptor for flock/fstat (file sink lock). */
+    pthread_mutex_t lock;  /**< Serializes config changes, dedup and backfill. */
     char current_date[16]; /**< Last-seen date string `YYYY-MM-DD` for date rotation. */
-    logx_timer_t timers[LOGX_MAX_TIMERS]; /**< Pool of stopwatch timers. */
-    int timer_count;                      /**< Number of active timers. */
-    int syslog_opened; /**< 1 if openlog() has been called for this logger instance. */
+    logx_timer_set_t timers;        /**< Stopwatch timers, with their own lock. */
+    int syslog_opened;              /**< 1 if openlog() has been called for this logger instance. */
+    logx_shed_t shed;               /**< Adaptive load-shedding state. */
+    logx_dedup_t dedup;             /**< Repeated-message deduplication state. */
+    logx_stats_t stats;             /**< Record counters (updated atomically). */
+    int control_attached;           /**< 1 if reachable through the control socket. */
+    char *cfg_path;                 /**< Config file the logger was loaded from, or NULL. */
+    logx_reload_t *reload;          /**< Config file watcher, or NULL. */
+    logx_sink_set_t sinks;          /**< Output sinks. */
+    logx_direct_t *direct;          /**< O_DIRECT writer of the file sink, or NULL. */
+    logx_recorder_t *recorder;      /**< Crash flight recorder, or NULL. */
+    logx_backfill_t backfill;       /**< Records held until a trigger record. */
+    logx_shm_t *shm;                /**< Shared-memory ring of the file sink, or NULL. */
+    logx_layout_view_t *view;       /**< Layout and banner records are rendered with (atomic). */
+    logx_layout_guard_t view_guard; /**< Readers of `view`, for freeing a replaced one. */
+    uint64_t seq;                   /**< Sequence number of the last record (updated atomically). */
 };
 
 #ifdef __cplusplus
@@ -264,6 +351,26 @@ extern "C"
      */
     logx_errorcodes_t logx_set_syslog_facility(logx_t *logger, logx_syslog_facility_t facility);
 
+    /**
+     * @brief Change the longest message the logger writes at runtime.
+     *
+     * Longer messages are cut and end with `...[truncated N bytes]`.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] bytes  Limit in bytes, marker included (0 = 1 MiB; values below
+     *                   `LOGX_MESSAGE_MIN_SIZE` are raised to it).
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_set_max_message_size(logx_t *logger, int bytes);
+
+    /**
+     * @brief Read the logger's record counters.
+     * @param[in]  logger Pointer to the logger instance.
+     * @param[out] out    Receives a consistent snapshot of the counters.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` if an argument is NULL.
+     */
+    logx_errorcodes_t logx_get_stats(logx_t *logger, logx_stats_t *out);
+
     /**
      * @brief Internal log dispatch function called by the `LOGX_*` macros.
      * @internal
@@ -286,7 +393,7 @@ extern "C"
      * @brief Extended log dispatch with per-call flags (e.g. `LOGX_FLAG_SYSLOG`).
      * @internal
      *
-     * Used by the `LOGX_*_SYSLOG` macros. Prefer those macros over calling this directly.
+     * For callers without a call site; the `LOGX_*_SYSLOG` macros use `logx_log_site()`.
      *
      * @param[in] logger Pointer to the logger instance.
      * @param[in] level  Severity level of the message.
@@ -301,9 +408,64 @@ extern "C"
                     const char *func, int line, const char *fmt, ...);
 
     /**
-     * @brief Internal rate-limit check used by `LOGX_FREQ` and the `LOGX_*_FREQ` macros.
+     * @brief Log dispatch with per-call flags and record annotations.
      * @internal
      *
+     * For callers without a call site; the rate-limited macros use `logx_log_site()`.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] level  Severity level of the message.
+     * @param[in] flags  Bitfield of `LOGX_FLAG_*` values.
+     * @param[in] annot  Annotations appended to the message, or NULL.
+     * @param[in] file   Source file name (stripped of directory prefix).
+     * @param[in] func   Calling function name.
+     * @param[in] line   Source line number.
+     * @param[in] fmt    printf-style format string.
+     * @param[in] ...    Format arguments.
+     */
+    void logx_log_ex(logx_t *logger, logx_level_t level, uint32_t flags, const logx_annot_t *annot,
+                     const char *file, const char *func, int line, const char *fmt, ...);
+
+    /**
+     * @brief Log dispatch from a `LOGX_*` call site.
+     * @internal
+     *
+     * Used by the logging macros. The level and location come from the site, and
+     * the location text is copied from the site's slot. With `LOGX_FLAG_FMT_LITERAL`,
+     * `fmt` is parsed once and kept in the site. Prefer the macros over calling this
+     * directly.
+     *
+     * @param[in]     logger Pointer to the logger instance.
+     * @param[in]     flags  Bitfield of `LOGX_FLAG_*` values.
+     * @param[in]     annot  Annotations appended to the message, or NULL.
+     * @param[in,out] site   Call site of the message.
+     * @param[in]     fmt    printf-style format string.
+     * @param[in]     ...    Format arguments.
+     */
+    void logx_log_site(logx_t *logger, uint32_t flags, const logx_annot_t *annot,
+                       logx_callsite_t *site, const char *fmt, ...);
+
+    /**
+     * @brief Check whether a record at `level` would reach a sink or the flight recorder.
+     * @internal
+     *
+     * Lock-free; the rate-limited macros call it before taking a token so a
+     * disabled level does not use up the burst.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] level  Severity level of the record.
+     * @param[in] flags  Bitfield of `LOGX_FLAG_*` values.
+     * @return 1 if the record would be written or recorded, 0 otherwise.
+     */
+    int logx_level_enabled(logx_t *logger, logx_level_t level, uint32_t flags);
+
+    /**
+     * @brief Raw rate-limit check behind `LOGX_FREQ`.
+     * @internal
+     *
+     * Kept for existing callers of `LOGX_FREQ`; it is not thread-safe and has
+     * one-second granularity. The `LOGX_*_FREQ` macros use `logx_ratelimit_acquire()`.
+     *
      * Returns 1 and updates `*last_logged` if at least `sec` seconds have elapsed
      * since the last allowed log. Returns 0 otherwise.
      *
@@ -325,153 +487,348 @@ extern "C"
 #define LOGX_FILENAME(path) \
     (__builtin_strrchr(path, '/') ? __builtin_strrchr(path, '/') + 1 : (path))
 
+/**
+ * @brief Internal — declare the `logx_callsite_t` of the enclosing call site and its
+ *        location slot.
+ * @internal
+ */
+#define LOGX_CALLSITE_DECLARE_(name, level)                              \
+    static char name##_loc_[LOGX_CALLSITE_LOC_SIZE(__FILE__, __func__)]; \
+    static logx_callsite_t name                                          \
+        __attribute__((section("logx_callsites"), used, aligned(8))) = { \
+            LOGX_FILENAME(__FILE__), __func__, __LINE__, (level),        \
+            LOGX_CALLSITE_INITIAL_STATE(level), 0, name##_loc_, NULL,    \
+            sizeof(name##_loc_), 0, 0}
+
+/**
+ * @brief Internal — translate call-site state bits into `LOGX_FLAG_*` bits.
+ * @internal
+ */
+#define LOGX_CALLSITE_FLAGS_(state) (((state) & LOGX_CALLSITE_FORCED) ? LOGX_FLAG_FORCE : 0U)
+
+/**
+ * @brief Internal — `LOGX_FLAG_FMT_LITERAL` if `fmt` is a string literal.
+ * @internal
+ */
+#define LOGX_FMT_FLAGS_(fmt) (__builtin_constant_p(fmt) ? LOGX_FLAG_FMT_LITERAL : 0U)
+
+/**
+ * @brief Internal helper behind the plain and `_SYSLOG` logging macros.
+ * @internal
+ *
+ * Registers the call site and checks its state with a single load; a disabled
+ * site does not evaluate its format arguments.
+ */
+#define LOGX_SITE_LOG_(logger, level, flags, fmt, ...)                                     \
+    do                                                                                     \
+    {                                                                                      \
+        LOGX_CALLSITE_DECLARE_(_logx_site, level);                                         \
+        uint32_t _logx_ss = logx_callsite_state(&_logx_site);                              \
+        if (_logx_ss)                                                                      \
+            logx_log_site((logger),                                                        \
+                          (flags) | LOGX_CALLSITE_FLAGS_(_logx_ss) | LOGX_FMT_FLAGS_(fmt), \
+                          NULL, &_logx_site, (fmt), ##__VA_ARGS__);                        \
+    } while (0)
+
 /** @defgroup logx_macros Logging macros
  *  Convenience macros that capture source location automatically.
  *  @{
  */
 
 /** @brief Log a TRACE-level message. */
-#define LOGX_TRACE(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_TRACE, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_TRACE(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_TRACE, 0, (fmt), ##__VA_ARGS__)
 /** @brief Log a DEBUG-level message. */
-#define LOGX_DEBUG(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_DEBUG, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_DEBUG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_DEBUG, 0, (fmt), ##__VA_ARGS__)
 /** @brief Log an INFO-level message. */
-#define LOGX_INFO(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_INFO, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_INFO(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_INFO, 0, (fmt), ##__VA_ARGS__)
 /** @brief Log a WARN-level message. */
-#define LOGX_WARN(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_WARN, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_WARN(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_WARN, 0, (fmt), ##__VA_ARGS__)
 /** @brief Log an ERROR-level message. */
-#define LOGX_ERROR(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_ERROR, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_ERROR(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_ERROR, 0, (fmt), ##__VA_ARGS__)
 /** @brief Log a BANNER-level message (auto-centered inside a border). */
-#define LOGX_BANNER(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_BANNER, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_BANNER(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_BANNER, 0, (fmt), ##__VA_ARGS__)
 /** @brief Log a FATAL-level message. */
-#define LOGX_FATAL(logger, fmt, ...)                                                         \
-    logx_log((logger), LOGX_LEVEL_FATAL, LOGX_FILENAME(__FILE__), __func__, __LINE__, (fmt), \
-             ##__VA_ARGS__)
+#define LOGX_FATAL(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_FATAL, 0, (fmt), ##__VA_ARGS__)
 
 /** @brief Log a TRACE message and also route it to syslog. */
-#define LOGX_TRACE_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_TRACE, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_TRACE_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_TRACE, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 /** @brief Log a DEBUG message and also route it to syslog. */
-#define LOGX_DEBUG_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_DEBUG, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_DEBUG_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_DEBUG, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 /** @brief Log an INFO message and also route it to syslog. */
-#define LOGX_INFO_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_INFO, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_INFO_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_INFO, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 /** @brief Log a WARN message and also route it to syslog. */
-#define LOGX_WARN_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_WARN, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_WARN_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_WARN, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 /** @brief Log an ERROR message and also route it to syslog. */
-#define LOGX_ERROR_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_ERROR, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_ERROR_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_ERROR, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 /** @brief Log a BANNER message and also route it to syslog. */
-#define LOGX_BANNER_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_BANNER, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_BANNER_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_BANNER, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 /** @brief Log a FATAL message and also route it to syslog. */
-#define LOGX_FATAL_SYSLOG(logger, fmt, ...)                                                     \
-    logx_log_f((logger), LOGX_LEVEL_FATAL, LOGX_FLAG_SYSLOG, LOGX_FILENAME(__FILE__), __func__, \
-               __LINE__, (fmt), ##__VA_ARGS__)
+#define LOGX_FATAL_SYSLOG(logger, fmt, ...) \
+    LOGX_SITE_LOG_((logger), LOGX_LEVEL_FATAL, LOGX_FLAG_SYSLOG, (fmt), ##__VA_ARGS__)
 
 /** @} */ /* logx_macros */
 
 /**
  * @brief Raw rate-limit gate — evaluates to 1 if `sec` seconds have elapsed since last pass.
  *
- * `last_logged` must be an lvalue of type `time_t`.
- * Prefer the `LOGX_*_FREQ` macros, which manage the state variable automatically.
+ * `last_logged` must be an lvalue of type `time_t`. Not thread-safe.
+ * Prefer the `LOGX_*_FREQ` macros, which keep lock-free per-call-site state.
  */
 #define LOGX_FREQ(sec, last_logged) logx_freq_check((sec), &(last_logged))
 
+/**
+ * @brief Internal helper behind the `LOGX_*_FREQ` and `LOGX_*_RATE` macros.
+ * @internal
+ *
+ * Declares a per-call-site `logx_ratelimit_t` and only evaluates the format
+ * arguments when a token is available. The site and level are checked first, so
+ * a disabled level does not use up the burst. When messages were dropped since
+ * the last emitted one, `" (N messages suppressed)"` is appended to the record.
+ */
+#define LOGX_RATELIMITED_(logger, level, interval_ns, burst, fmt, ...)                        \
+    do                                                                                        \
+    {                                                                                         \
+        LOGX_CALLSITE_DECLARE_(_logx_site, level);                                            \
+        static logx_ratelimit_t _logx_rl = {0, 0};                                            \
+        static LOGX_THREAD_LOCAL logx_ratelimit_local_t _logx_rt;                             \
+        logx_t *_logx_lg   = (logger);                                                        \
+        uint64_t _logx_sup = 0;                                                               \
+        uint32_t _logx_ss  = logx_callsite_state(&_logx_site);                                \
+        uint32_t _logx_fl  = LOGX_CALLSITE_FLAGS_(_logx_ss);                                  \
+        if (_logx_ss && logx_level_enabled(_logx_lg, (level), _logx_fl) &&                    \
+            logx_ratelimit_acquire(&_logx_rl, &_logx_rt, (interval_ns), (burst), &_logx_sup)) \
+        {                                                                                     \
+            logx_annot_t _logx_an = {0};                                                      \
+            _logx_an.suppressed   = _logx_sup;                                                \
+            logx_log_site(_logx_lg, _logx_fl | LOGX_FMT_FLAGS_(fmt), &_logx_an, &_logx_site,  \
+                          (fmt), ##__VA_ARGS__);                                              \
+        }                                                                                     \
+    } while (0)
+
 /** @defgroup logx_freq_macros Rate-limited logging macros
  *
- *  Each macro suppresses the log call if fewer than `sec` seconds have elapsed
- *  since the same call site last produced output.  Each call site maintains its
- *  own independent `static time_t` counter.
+ *  `LOGX_*_FREQ` lets a call site through at most once every `sec` seconds;
+ *  `sec` may be fractional (e.g. `0.25`).  `LOGX_*_RATE` is the general token
+ *  bucket: `per_sec` messages per second sustained, with bursts of up to `burst`.
+ *
+ *  Each call site owns an independent lock-free bucket, so the macros are safe
+ *  to use from several threads.  Suppressed calls do not evaluate their format
+ *  arguments, and the next emitted message reports how many were dropped, e.g.
+ *  `"link down (41 messages suppressed)"`.
  *
  *  @{
  */
 
 /** @brief Log a TRACE message at most once every `sec` seconds. */
-#define LOGX_TRACE_FREQ(logger, sec, fmt, ...)          \
-    do                                                  \
-    {                                                   \
-        static time_t _last = 0;                        \
-        if (LOGX_FREQ((sec), _last))                    \
-            LOGX_TRACE((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_TRACE_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_TRACE, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
 
 /** @brief Log a DEBUG message at most once every `sec` seconds. */
-#define LOGX_DEBUG_FREQ(logger, sec, fmt, ...)          \
-    do                                                  \
-    {                                                   \
-        static time_t _last = 0;                        \
-        if (LOGX_FREQ((sec), _last))                    \
-            LOGX_DEBUG((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_DEBUG_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_DEBUG, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
 
 /** @brief Log an INFO message at most once every `sec` seconds. */
-#define LOGX_INFO_FREQ(logger, sec, fmt, ...)          \
-    do                                                 \
-    {                                                  \
-        static time_t _last = 0;                       \
-        if (LOGX_FREQ((sec), _last))                   \
-            LOGX_INFO((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_INFO_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_INFO, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
 
 /** @brief Log a WARN message at most once every `sec` seconds. */
-#define LOGX_WARN_FREQ(logger, sec, fmt, ...)          \
-    do                                                 \
-    {                                                  \
-        static time_t _last = 0;                       \
-        if (LOGX_FREQ((sec), _last))                   \
-            LOGX_WARN((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_WARN_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_WARN, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
 
 /** @brief Log an ERROR message at most once every `sec` seconds. */
-#define LOGX_ERROR_FREQ(logger, sec, fmt, ...)          \
-    do                                                  \
-    {                                                   \
-        static time_t _last = 0;                        \
-        if (LOGX_FREQ((sec), _last))                    \
-            LOGX_ERROR((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_ERROR_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_ERROR, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
 
 /** @brief Log a FATAL message at most once every `sec` seconds. */
-#define LOGX_FATAL_FREQ(logger, sec, fmt, ...)          \
-    do                                                  \
-    {                                                   \
-        static time_t _last = 0;                        \
-        if (LOGX_FREQ((sec), _last))                    \
-            LOGX_FATAL((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_FATAL_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_FATAL, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
 
 /** @brief Log a BANNER message at most once every `sec` seconds. */
-#define LOGX_BANNER_FREQ(logger, sec, fmt, ...)          \
-    do                                                   \
-    {                                                    \
-        static time_t _last = 0;                         \
-        if (LOGX_FREQ((sec), _last))                     \
-            LOGX_BANNER((logger), (fmt), ##__VA_ARGS__); \
-    } while (0)
+#define LOGX_BANNER_FREQ(logger, sec, fmt, ...)                                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_BANNER, logx_ratelimit_sec_to_ns(sec), 1, (fmt), \
+                      ##__VA_ARGS__)
+
+/** @brief Log a TRACE message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_TRACE_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_TRACE, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a DEBUG message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_DEBUG_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_DEBUG, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
+
+/** @brief Log an INFO message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_INFO_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_INFO, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a WARN message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_WARN_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_WARN, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
+
+/** @brief Log an ERROR message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_ERROR_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_ERROR, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a FATAL message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_FATAL_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_FATAL, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a BANNER message at `per_sec` messages/s with bursts of up to `burst`. */
+#define LOGX_BANNER_RATE(logger, per_sec, burst, fmt, ...)                             \
+    LOGX_RATELIMITED_((logger), LOGX_LEVEL_BANNER, logx_ratelimit_rate_to_ns(per_sec), \
+                      (burst), (fmt), ##__VA_ARGS__)
 
     /** @} */ /* logx_freq_macros */
 
+/**
+ * @brief Internal helper behind the `LOGX_*_SAMPLE` macros.
+ * @internal
+ *
+ * Keeps a thread-local 1-in-`n` counter per call site.  Calls below the logger
+ * level do not advance it; skipped calls do not evaluate their format arguments.
+ */
+#define LOGX_SAMPLE_EVERY_(logger, level, n, fmt, ...)                                       \
+    do                                                                                       \
+    {                                                                                        \
+        LOGX_CALLSITE_DECLARE_(_logx_site, level);                                           \
+        static LOGX_THREAD_LOCAL uint32_t _logx_sc = 0;                                      \
+        logx_t *_logx_lg                           = (logger);                               \
+        uint32_t _logx_n                           = (uint32_t)(n);                          \
+        uint32_t _logx_ss                          = logx_callsite_state(&_logx_site);       \
+        uint32_t _logx_fl                          = LOGX_CALLSITE_FLAGS_(_logx_ss);         \
+        if (_logx_ss && logx_level_enabled(_logx_lg, (level), _logx_fl) &&                   \
+            logx_sample_every(&_logx_sc, _logx_n))                                           \
+        {                                                                                    \
+            logx_annot_t _logx_an = {0};                                                     \
+            _logx_an.sample_rate  = (_logx_n > 1) ? 1.0 / _logx_n : 1.0;                     \
+            logx_log_site(_logx_lg, _logx_fl | LOGX_FMT_FLAGS_(fmt), &_logx_an, &_logx_site, \
+                          (fmt), ##__VA_ARGS__);                                             \
+        }                                                                                    \
+    } while (0)
+
+/**
+ * @brief Internal helper behind the `LOGX_*_PROB` macros.
+ * @internal
+ *
+ * Draws from the calling thread's PRNG only for calls at or above the logger
+ * level; skipped calls do not evaluate their format arguments.
+ */
+#define LOGX_SAMPLE_PROB_(logger, level, p, fmt, ...)                                        \
+    do                                                                                       \
+    {                                                                                        \
+        LOGX_CALLSITE_DECLARE_(_logx_site, level);                                           \
+        logx_t *_logx_lg  = (logger);                                                        \
+        double _logx_p    = (p);                                                             \
+        uint32_t _logx_ss = logx_callsite_state(&_logx_site);                                \
+        uint32_t _logx_fl = LOGX_CALLSITE_FLAGS_(_logx_ss);                                  \
+        if (_logx_ss && logx_level_enabled(_logx_lg, (level), _logx_fl) &&                   \
+            logx_sample_prob(_logx_p))                                                       \
+        {                                                                                    \
+            logx_annot_t _logx_an = {0};                                                     \
+            _logx_an.sample_rate  = (_logx_p < 1.0) ? _logx_p : 1.0;                         \
+            logx_log_site(_logx_lg, _logx_fl | LOGX_FMT_FLAGS_(fmt), &_logx_an, &_logx_site, \
+                          (fmt), ##__VA_ARGS__);                                             \
+        }                                                                                    \
+    } while (0)
+
+/** @defgroup logx_sample_macros Sampled logging macros
+ *
+ *  For high-rate traces where an unbiased sample is more useful than a time-based
+ *  throttle.  `LOGX_*_SAMPLE` keeps one call out of `n` at each call site (the
+ *  first one, then every `n`-th); `LOGX_*_PROB` keeps each call with probability
+ *  `p`.
+ *
+ *  Counters and the random generator are thread-local, so sampling never touches
+ *  shared state, and skipped calls do not evaluate their format arguments.  The
+ *  sampling rate is appended to every kept record, e.g.
+ *  `"cache miss key=42 (sample_rate=0.01)"`, so counts can be scaled back up by
+ *  `1 / sample_rate` offline.
+ *
+ *  @{
+ */
+
+/** @brief Log a TRACE message on one call out of `n` (per thread). */
+#define LOGX_TRACE_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_TRACE, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a DEBUG message on one call out of `n` (per thread). */
+#define LOGX_DEBUG_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_DEBUG, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log an INFO message on one call out of `n` (per thread). */
+#define LOGX_INFO_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_INFO, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a WARN message on one call out of `n` (per thread). */
+#define LOGX_WARN_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_WARN, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log an ERROR message on one call out of `n` (per thread). */
+#define LOGX_ERROR_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_ERROR, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a FATAL message on one call out of `n` (per thread). */
+#define LOGX_FATAL_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_FATAL, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a BANNER message on one call out of `n` (per thread). */
+#define LOGX_BANNER_SAMPLE(logger, n, fmt, ...) \
+    LOGX_SAMPLE_EVERY_((logger), LOGX_LEVEL_BANNER, (n), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a TRACE message with probability `p`. */
+#define LOGX_TRACE_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_TRACE, (p), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a DEBUG message with probability `p`. */
+#define LOGX_DEBUG_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_DEBUG, (p), (fmt), ##__VA_ARGS__)
+
+/** @brief Log an INFO message with probability `p`. */
+#define LOGX_INFO_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_INFO, (p), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a WARN message with probability `p`. */
+#define LOGX_WARN_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_WARN, (p), (fmt), ##__VA_ARGS__)
+
+/** @brief Log an ERROR message with probability `p`. */
+#define LOGX_ERROR_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_ERROR, (p), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a FATAL message with probability `p`. */
+#define LOGX_FATAL_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_FATAL, (p), (fmt), ##__VA_ARGS__)
+
+/** @brief Log a BANNER message with probability `p`. */
+#define LOGX_BANNER_PROB(logger, p, fmt, ...) \
+    LOGX_SAMPLE_PROB_((logger), LOGX_LEVEL_BANNER, (p), (fmt), ##__VA_ARGS__)
+
+    /** @} */ /* logx_sample_macros */
+
 #ifdef __cplusplus
 }
 #endif
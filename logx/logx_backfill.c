@@ -0,0 +1,170 @@
+/**
+ * @file logx_backfill.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Error-triggered backfill ring.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "logx_backfill.h"
+#include "logx.h"
+#include "logx_common.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Header in front of every held record. Records never wrap around the end of
+ *        the ring; the space they skip is marked with `size` 0 when a header fits.
+ */
+typedef struct
+{
+    uint32_t size;     /**< Bytes taken by the record, header included; 0 = skip to start. */
+    uint32_t len;      /**< Payload length without the NUL. */
+    int32_t level;     /**< Record level. */
+    uint32_t flags;    /**< `LOGX_FLAG_*` bits. */
+    int32_t line;      /**< Call-site line. */
+    struct timeval tv; /**< Time the record was logged. */
+    unsigned long tid; /**< Thread that logged the record. */
+    const char *file;  /**< Call-site file. */
+    const char *func;  /**< Call-site function. */
+} backfill_hdr_t;
+
+/** @brief Round up to the ring's 8-byte granularity. */
+#define BACKFILL_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+/**
+ * @brief Header of the oldest held record, skipping the padding in front of it.
+ */
+static backfill_hdr_t *backfill_oldest(logx_backfill_t *b)
+{
+    size_t off          = (size_t)(b->head % b->cap);
+    backfill_hdr_t *hdr = (backfill_hdr_t *)(b->buf + off);
+
+    if (b->cap - off < sizeof(*hdr) || hdr->size == 0)
+    {
+        b->head += b->cap - off;
+        hdr = (backfill_hdr_t *)b->buf;
+    }
+    return hdr;
+}
+
+logx_errorcodes_t logx_backfill_init(logx_backfill_t *b, size_t size)
+{
+    memset(b, 0, sizeof(*b));
+
+    b->cap = BACKFILL_ALIGN(size < LOGX_BACKFILL_MIN_SIZE ? LOGX_BACKFILL_MIN_SIZE : size);
+    b->buf = malloc(b->cap);
+    if (!b->buf)
+    {
+        b->cap = 0;
+        return LOGX_ERR_NO_MEM;
+    }
+    return LOGX_ERR_SUCCESS;
+}
+
+void logx_backfill_free(logx_backfill_t *b)
+{
+    free(b->buf);
+    memset(b, 0, sizeof(*b));
+}
+
+void logx_backfill_push(logx_backfill_t *b, const struct timeval *tv, logx_level_t level,
+                        uint32_t flags, const char *file, const char *func, int line,
+                        const char *payload)
+{
+    size_t len  = strlen(payload);
+    size_t need = BACKFILL_ALIGN(sizeof(backfill_hdr_t) + len + 1);
+    size_t off  = 0;
+    size_t gap  = 0;
+
+    if (need > b->cap)
+    {
+        len  = b->cap - sizeof(backfill_hdr_t) - 1;
+        need = b->cap;
+    }
+
+    /* Make room: a record that does not fit before the end starts over at offset 0 */
+    for (;;)
+    {
+        if (b->count == 0)
+            b->head = b->tail = 0;
+
+        off = (size_t)(b->tail % b->cap);
+        gap = (b->cap - off < need) ? b->cap - off : 0;
+        if (b->tail + gap + need - b->head <= b->cap)
+            break;
+
+        backfill_hdr_t *old = backfill_oldest(b);
+        b->head += old->size;
+        b->count--;
+    }
+
+    if (gap)
+    {
+        if (gap >= sizeof(backfill_hdr_t))
+            ((backfill_hdr_t *)(b->buf + off))->size = 0;
+        b->tail += gap;
+        off = 0;
+    }
+
+    backfill_hdr_t *hdr = (backfill_hdr_t *)(b->buf + off);
+    hdr->size           = (uint32_t)need;
+    hdr->len            = (uint32_t)len;
+    hdr->level          = (int32_t)level;
+    hdr->flags          = flags;
+    hdr->line           = line;
+    hdr->tv             = *tv;
+    hdr->tid            = logx_thread_id();
+    hdr->file           = file;
+    hdr->func           = func;
+    memcpy(hdr + 1, payload, len);
+    ((char *)(hdr + 1))[len] = '\0';
+
+    b->tail += need;
+    b->count++;
+}
+
+int logx_backfill_pop(logx_backfill_t *b, logx_backfill_record_t *rec)
+{
+    if (b->count == 0)
+        return 0;
+
+    backfill_hdr_t *hdr = backfill_oldest(b);
+    rec->tv             = hdr->tv;
+    rec->tid            = hdr->tid;
+    rec->level          = (logx_level_t)hdr->level;
+    rec->flags          = hdr->flags;
+    rec->file           = hdr->file;
+    rec->func           = hdr->func;
+    rec->line           = hdr->line;
+    rec->payload        = (const char *)(hdr + 1);
+
+    b->head += hdr->size;
+    b->count--;
+    return 1;
+}
+
+logx_errorcodes_t logx_set_backfill_levels(logx_t *logger, logx_level_t level,
+                                           logx_level_t trigger_level)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger || level < LOGX_LEVEL_TRACE || level > LOGX_LEVEL_OFF ||
+        trigger_level < LOGX_LEVEL_TRACE || trigger_level > LOGX_LEVEL_OFF)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.backfill_level, level, __ATOMIC_RELAXED);
+    __atomic_store_n(&logger->cfg.backfill_trigger_level, trigger_level, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&logger->lock);
+
+END:
+    return eErr;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file logx_backfill.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Error-triggered backfill — hold low-level records in a ring and write them
+ *        only when a record at the trigger level shows up.
+ *
+ * With `backfill_size` > 0, records below `backfill_level` that some sink would
+ * write are formatted and kept in a per-logger ring of `backfill_size` bytes
+ * instead of reaching the sinks. When a record at or above
+ * `backfill_trigger_level` is written, the held records are written first, in
+ * the order they were logged, with their original timestamps. Without a
+ * trigger, the oldest held records are silently overwritten as the ring fills.
+ * Held records are discarded when the logger is destroyed.
+ *
+ * The ring is per logger rather than per thread, so the context written before
+ * an error interleaves the threads exactly as they logged.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_BACKFILL_H
+#define LOGX_BACKFILL_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+/** @brief Smallest backfill ring in bytes; smaller `backfill_size` values are raised to it. */
+#ifndef LOGX_BACKFILL_MIN_SIZE
+#define LOGX_BACKFILL_MIN_SIZE 4096
+#endif
+
+/**
+ * @brief Per-logger backfill ring embedded in `logx_t`. Protected by the logger lock.
+ */
+typedef struct
+{
+    char *buf;     /**< Ring storage, or NULL when backfill is off. */
+    size_t cap;    /**< Size of `buf` in bytes (multiple of 8). */
+    uint64_t head; /**< Position of the oldest held record. */
+    uint64_t tail; /**< Position where the next record goes. */
+    size_t count;  /**< Number of held records. */
+} logx_backfill_t;
+
+/**
+ * @brief A held record handed back by `logx_backfill_pop()`.
+ * @internal
+ */
+typedef struct
+{
+    struct timeval tv;   /**< Time the record was logged. */
+    unsigned long tid;   /**< Thread that logged the record. */
+    logx_level_t level;  /**< Record level. */
+    uint32_t flags;      /**< `LOGX_FLAG_*` bits of the record. */
+    const char *file;    /**< Call-site file. */
+    const char *func;    /**< Call-site function. */
+    int line;            /**< Call-site line. */
+    const char *payload; /**< Formatted message text, inside the ring. */
+} logx_backfill_record_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Change which records are held back and which records release them.
+     *
+     * Only takes effect on loggers created with `backfill_size` > 0.
+     *
+     * @param[in] logger        Pointer to the logger instance.
+     * @param[in] level         Records below this level are held (`LOGX_LEVEL_TRACE`
+     *                          holds nothing).
+     * @param[in] trigger_level Records at or above this level write the held records
+     *                          before themselves.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_set_backfill_levels(logx_t *logger, logx_level_t level,
+                                               logx_level_t trigger_level);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @brief Internal — allocate the ring.
+ * @internal
+ * @param[out] b    Backfill state (zeroed).
+ * @param[in]  size Requested ring size in bytes.
+ * @return `LOGX_ERR_SUCCESS` or `LOGX_ERR_NO_MEM`.
+ */
+logx_errorcodes_t logx_backfill_init(logx_backfill_t *b, size_t size);
+
+/**
+ * @brief Internal — free the ring and discard the held records.
+ * @internal
+ * @param[in,out] b Backfill state.
+ */
+void logx_backfill_free(logx_backfill_t *b);
+
+/**
+ * @brief Internal — hold a formatted record, overwriting the oldest ones if needed.
+ * @internal
+ *
+ * Must be called with the logger lock held. A payload too long for the whole ring
+ * is truncated.
+ */
+void logx_backfill_push(logx_backfill_t *b, const struct timeval *tv, logx_level_t level,
+                        uint32_t flags, const char *file, const char *func, int line,
+                        const char *payload);
+
+/**
+ * @brief Internal — take the oldest held record.
+ * @internal
+ *
+ * Must be called with the logger lock held. `rec->payload` stays valid until the
+ * next `logx_backfill_push()`.
+ *
+ * @param[in,out] b   Backfill state.
+ * @param[out]    rec Receives the record.
+ * @return 1 if a record was taken, 0 if none is held.
+ */
+int logx_backfill_pop(logx_backfill_t *b, logx_backfill_record_t *rec);
+
+#endif /* LOGX_BACKFILL_H */
@@ -0,0 +1,236 @@
+/**
+ * @file logx_callsite.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Runtime per-call-site enable/disable registry.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "logx_callsite.h"
+#include "logx_errorcodes.h"
+#include <fnmatch.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+
+/** @brief Maximum number of modules (executable + shared objects) with call sites. */
+#define LOGX_CALLSITE_MAX_MODULES 64
+
+/**
+ * @brief Call-site array of one module.
+ */
+typedef struct
+{
+    logx_callsite_t *start; /**< First site. */
+    logx_callsite_t *stop;  /**< One past the last site. */
+} logx_callsite_module_t;
+
+static logx_callsite_module_t g_modules[LOGX_CALLSITE_MAX_MODULES];
+static int g_module_count            = 0;
+static pthread_mutex_t g_module_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void logx_callsite_register(logx_callsite_t *start, logx_callsite_t *stop)
+{
+    if (!start || stop <= start)
+        return;
+
+    pthread_mutex_lock(&g_module_lock);
+
+    for (int i = 0; i < g_module_count; i++)
+    {
+        if (g_modules[i].start == start)
+            goto END;
+    }
+
+    if (g_module_count < LOGX_CALLSITE_MAX_MODULES)
+    {
+        g_modules[g_module_count].start = start;
+        g_modules[g_module_count].stop  = stop;
+        g_module_count++;
+    }
+
+END:
+    pthread_mutex_unlock(&g_module_lock);
+}
+
+void logx_callsite_unregister(logx_callsite_t *start)
+{
+    pthread_mutex_lock(&g_module_lock);
+
+    for (int i = 0; i < g_module_count; i++)
+    {
+        if (g_modules[i].start == start)
+        {
+            g_modules[i] = g_modules[--g_module_count];
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&g_module_lock);
+}
+
+/**
+ * @brief Check a call site against the filters of `logx_callsite_set()`.
+ *
+ * @return 1 if the site matches every filter, 0 otherwise.
+ */
+static int callsite_matches(const logx_callsite_t *site, const char *file_glob,
+                            const char *func_glob, int line_min, int line_max)
+{
+    if (file_glob && fnmatch(file_glob, site->file ? site->file : "", 0) != 0)
+        return 0;
+    if (func_glob && fnmatch(func_glob, site->func ? site->func : "", 0) != 0)
+        return 0;
+    if (line_min > 0 && site->line < line_min)
+        return 0;
+    if (line_max > 0 && site->line > line_max)
+        return 0;
+    return 1;
+}
+
+logx_errorcodes_t logx_callsite_set(const char *file_glob, const char *func_glob,
+                                    int line_min, int line_max, logx_callsite_state_t state,
+                                    int *matched)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    int count              = 0;
+
+    /* Sanity check */
+    if (line_min < 0 || line_max < 0 || (line_max > 0 && line_min > line_max) ||
+        (state != LOGX_CALLSITE_OFF && state != LOGX_CALLSITE_DEFAULT &&
+         state != LOGX_CALLSITE_ON))
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&g_module_lock);
+
+    for (int i = 0; i < g_module_count; i++)
+    {
+        for (logx_callsite_t *site = g_modules[i].start; site < g_modules[i].stop; site++)
+        {
+            if (!callsite_matches(site, file_glob, func_glob, line_min, line_max))
+                continue;
+
+            __atomic_store_n(&site->state, (uint32_t)state, __ATOMIC_RELAXED);
+            count++;
+        }
+    }
+
+    pthread_mutex_unlock(&g_module_lock);
+
+END:
+    if (matched)
+        *matched = count;
+    return eErr;
+}
+
+logx_errorcodes_t logx_callsite_foreach(logx_callsite_cb_t cb, void *ctx)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!cb)
+    {
+        eErr = LOGX_ERR_NULL_PTR;
+        goto END;
+    }
+
+    pthread_mutex_lock(&g_module_lock);
+
+    for (int i = 0; i < g_module_count; i++)
+    {
+        for (const logx_callsite_t *site = g_modules[i].start; site < g_modules[i].stop; site++)
+            cb(site, (logx_callsite_state_t)logx_callsite_state(site), ctx);
+    }
+
+    pthread_mutex_unlock(&g_module_lock);
+
+END:
+    return eErr;
+}
+
+size_t logx_callsite_loc_format(char *buf, size_t size, const char *file, const char *func,
+                                int line, logx_callsite_loc_t *loc)
+{
+    char digits[12];
+    char *p          = digits + sizeof(digits);
+    unsigned int val = line < 0 ? 0U - (unsigned int)line : (unsigned int)line;
+    size_t file_len  = 0;
+    size_t func_len  = 0;
+    size_t line_len  = 0;
+    size_t need      = 0;
+
+    if (!file)
+        file = "?";
+    if (!func)
+        func = "?";
+
+    do
+    {
+        *--p = (char)('0' + val % 10);
+        val /= 10;
+    } while (val);
+    if (line < 0)
+        *--p = '-';
+
+    file_len = strlen(file);
+    func_len = strlen(func);
+    line_len = (size_t)(digits + sizeof(digits) - p);
+    need     = file_len + func_len + line_len + 3;
+
+    if (need > size)
+        goto END;
+
+    memcpy(buf, file, file_len);
+    buf[file_len] = ':';
+    memcpy(buf + file_len + 1, func, func_len);
+    buf[file_len + 1 + func_len] = ':';
+    memcpy(buf + file_len + func_len + 2, p, line_len);
+    buf[need - 1] = '\0';
+
+    loc->text     = buf;
+    loc->len      = need - 1;
+    loc->file_len = file_len;
+    loc->func_len = func_len;
+
+END:
+    return need;
+}
+
+int logx_callsite_loc(logx_callsite_t *site, logx_callsite_loc_t *loc)
+{
+    uint32_t len   = __atomic_load_n(&site->loc_len, __ATOMIC_ACQUIRE);
+    uint32_t empty = 0;
+
+    if (len == LOGX_CALLSITE_LOC_BUSY)
+        return 0;
+
+    if (len)
+    {
+        loc->text     = site->loc;
+        loc->len      = len;
+        loc->file_len = site->loc_file;
+        loc->func_len = site->loc_func;
+        return 1;
+    }
+
+    /* First record of the site: one thread fills the slot, the others format their own copy */
+    if (!site->loc || !__atomic_compare_exchange_n(&site->loc_len, &empty, LOGX_CALLSITE_LOC_BUSY,
+                                                   0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        return 0;
+
+    /* A slot that is too small stays busy, so the site keeps formatting per record */
+    if (logx_callsite_loc_format(site->loc, site->loc_size, site->file, site->func, site->line,
+                                 loc) > site->loc_size ||
+        loc->file_len > UINT16_MAX || loc->func_len > UINT16_MAX)
+        return 0;
+
+    site->loc_file = (uint16_t)loc->file_len;
+    site->loc_func = (uint16_t)loc->func_len;
+    __atomic_store_n(&site->loc_len, (uint32_t)loc->len, __ATOMIC_RELEASE);
+    return 1;
+}
@@ -0,0 +1,250 @@
+/**
+ * @file logx_callsite.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Runtime per-call-site enable/disable registry, in the style of Linux dynamic debug.
+ *
+ * Every `LOGX_*` call site owns a static `logx_callsite_t` placed in the
+ * `logx_callsites` ELF section. The linker gathers them into one array per
+ * executable or shared object, which registers itself at load time. The logging
+ * macros check the site state with a single relaxed load before doing anything
+ * else, so a site that is switched off costs no more than a predictable branch
+ * and never evaluates its arguments.
+ *
+ * Each site also owns a static slot for its location text, `file:func:line`. The
+ * slot is sized at compile time and filled by the first record of the site;
+ * later records copy it instead of formatting the location again. A site with a
+ * string-literal format keeps the parsed format there too (`logx_format.h`).
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_CALLSITE_H
+#define LOGX_CALLSITE_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Site state bit: the site may log; the logger's levels still apply. */
+#define LOGX_CALLSITE_ENABLED (1U << 0)
+
+/** @brief Site state bit: the site logs regardless of the logger's console/file levels. */
+#define LOGX_CALLSITE_FORCED (1U << 1)
+
+/**
+ * @brief Call-site states accepted by `logx_callsite_set()`.
+ */
+typedef enum
+{
+    LOGX_CALLSITE_OFF     = 0,                     /**< Never log. */
+    LOGX_CALLSITE_DEFAULT = LOGX_CALLSITE_ENABLED, /**< Follow the logger's levels. */
+    LOGX_CALLSITE_ON = LOGX_CALLSITE_ENABLED | LOGX_CALLSITE_FORCED /**< Always log. */
+} logx_callsite_state_t;
+
+/**
+ * @brief Initial state of a call site, chosen at compile time from its level.
+ *
+ * Define before including `logx.h` to change it, e.g. to start with every TRACE
+ * and DEBUG site switched off and turn them on selectively at runtime:
+ *
+ * @code
+ * #define LOGX_CALLSITE_INITIAL_STATE(level) \
+ *     ((level) <= LOGX_LEVEL_DEBUG ? LOGX_CALLSITE_OFF : LOGX_CALLSITE_DEFAULT)
+ * @endcode
+ */
+#ifndef LOGX_CALLSITE_INITIAL_STATE
+#define LOGX_CALLSITE_INITIAL_STATE(level) LOGX_CALLSITE_DEFAULT
+#endif
+
+/**
+ * @brief Size of the location slot of a call site in source file `file` and function `func`.
+ *
+ * The terminators of both names make room for the two separators; 12 bytes hold
+ * the line number, its sign and the terminating NUL.
+ */
+#define LOGX_CALLSITE_LOC_SIZE(file, func) (sizeof(file) + sizeof(func) + 12)
+
+/** @brief `logx_callsite_t::loc_len` while the slot is being filled, or when it cannot be. */
+#define LOGX_CALLSITE_LOC_BUSY UINT32_MAX
+
+struct logx_format;
+
+/**
+ * @brief One logging call site. Emitted by the `LOGX_*` macros; never create one by hand.
+ *
+ * The size is a multiple of the alignment so that the linker lays the section
+ * out as a plain array.
+ */
+typedef struct
+{
+    const char *file;              /**< Source file name (directory prefix stripped). */
+    const char *func;              /**< Enclosing function. */
+    int line;                      /**< Source line. */
+    logx_level_t level;            /**< Level of the call. */
+    uint32_t state;                /**< `LOGX_CALLSITE_*` bits; `__atomic`. */
+    uint32_t loc_len;              /**< Length of the text in `loc`, 0 until filled; `__atomic`. */
+    char *loc;                     /**< Location slot, `loc_size` bytes. */
+    const struct logx_format *fmt; /**< Parsed format, NULL until the first record; `__atomic`. */
+    uint32_t loc_size;             /**< Size of `loc`. */
+    uint16_t loc_file;             /**< Length of the file part of `loc`. */
+    uint16_t loc_func;             /**< Length of the function part of `loc`. */
+} logx_callsite_t;
+
+/**
+ * @brief A call-site location as `file:func:line` text.
+ */
+typedef struct
+{
+    const char *text; /**< `file:func:line`. */
+    size_t len;       /**< Length of `text`. */
+    size_t file_len;  /**< Length of the file part. */
+    size_t func_len;  /**< Length of the function part. */
+} logx_callsite_loc_t;
+
+/**
+ * @brief Callback for `logx_callsite_foreach()`.
+ *
+ * @param[in] site  Call site.
+ * @param[in] state Current state of the site.
+ * @param[in] ctx   User context passed to `logx_callsite_foreach()`.
+ */
+typedef void (*logx_callsite_cb_t)(const logx_callsite_t *site, logx_callsite_state_t state,
+                                   void *ctx);
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Change the state of every registered call site matching all given filters.
+     *
+     * @param[in]  file_glob `fnmatch()` pattern for the file name, or NULL for any file.
+     * @param[in]  func_glob `fnmatch()` pattern for the function name, or NULL for any function.
+     * @param[in]  line_min  First line of the range, or 0 for no lower bound.
+     * @param[in]  line_max  Last line of the range (inclusive), or 0 for no upper bound.
+     * @param[in]  state     New state for the matching sites.
+     * @param[out] matched   Receives the number of sites changed. May be NULL.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_callsite_set(const char *file_glob, const char *func_glob,
+                                        int line_min, int line_max, logx_callsite_state_t state,
+                                        int *matched);
+
+    /**
+     * @brief Call `cb` for every registered call site.
+     *
+     * @param[in] cb  Callback. Must not call `logx_callsite_set()`.
+     * @param[in] ctx User context passed to `cb`.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_NULL_PTR` if `cb` is NULL.
+     */
+    logx_errorcodes_t logx_callsite_foreach(logx_callsite_cb_t cb, void *ctx);
+
+    /**
+     * @brief Register the call-site array of one executable or shared object.
+     * @internal
+     *
+     * Called automatically at load time; registering the same array twice is a no-op.
+     *
+     * @param[in] start First site of the array.
+     * @param[in] stop  One past the last site.
+     */
+    void logx_callsite_register(logx_callsite_t *start, logx_callsite_t *stop);
+
+    /**
+     * @brief Forget a call-site array registered with `logx_callsite_register()`.
+     * @internal
+     *
+     * @param[in] start First site of the array.
+     */
+    void logx_callsite_unregister(logx_callsite_t *start);
+
+    /**
+     * @brief Format a location as `file:func:line`.
+     * @internal
+     *
+     * A NULL file or function is written as `?`. Nothing is written if `size` is too small.
+     *
+     * @param[out] buf  Destination.
+     * @param[in]  size Size of `buf` in bytes.
+     * @param[in]  file Source file name, or NULL.
+     * @param[in]  func Function name, or NULL.
+     * @param[in]  line Source line.
+     * @param[out] loc  Receives the formatted location when it fits.
+     * @return Bytes needed, terminating NUL included.
+     */
+    size_t logx_callsite_loc_format(char *buf, size_t size, const char *file, const char *func,
+                                    int line, logx_callsite_loc_t *loc);
+
+    /**
+     * @brief Location of a call site, from its slot.
+     * @internal
+     *
+     * The first call fills the slot. While another thread fills it, or if it
+     * cannot be filled, the caller formats the location itself.
+     *
+     * @param[in,out] site Call site.
+     * @param[out]    loc  Receives the location.
+     * @return 1 if `loc` was filled, 0 otherwise.
+     */
+    int logx_callsite_loc(logx_callsite_t *site, logx_callsite_loc_t *loc);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @brief Linker-provided bounds of this module's `logx_callsites` section.
+ * @internal
+ *
+ * Weak, so they resolve to NULL in a module without call sites, and hidden, so
+ * every executable and shared object sees its own array.
+ */
+extern logx_callsite_t __start_logx_callsites[] __attribute__((weak, visibility("hidden")));
+extern logx_callsite_t __stop_logx_callsites[] __attribute__((weak, visibility("hidden")));
+
+/**
+ * @brief Register this module's call sites at load time.
+ * @internal
+ *
+ * Emitted into every translation unit that includes `logx.h`; all copies in a
+ * module register the same array, which the registry de-duplicates.
+ */
+__attribute__((constructor, used)) static void logx_callsite_autoregister_(void)
+{
+    logx_callsite_t *start = __start_logx_callsites;
+    logx_callsite_t *stop  = __stop_logx_callsites;
+
+    if (start != stop)
+        logx_callsite_register(start, stop);
+}
+
+/**
+ * @brief Drop this module's call sites when it is unloaded (e.g. `dlclose()`).
+ * @internal
+ */
+__attribute__((destructor, used)) static void logx_callsite_autounregister_(void)
+{
+    logx_callsite_t *start = __start_logx_callsites;
+
+    if (start)
+        logx_callsite_unregister(start);
+}
+
+/**
+ * @brief Current state bits of a call site — a single relaxed load.
+ * @internal
+ *
+ * @param[in] site Call site.
+ * @return `LOGX_CALLSITE_*` bits.
+ */
+static inline uint32_t logx_callsite_state(const logx_callsite_t *site)
+{
+    return __atomic_load_n(&site->state, __ATOMIC_RELAXED);
+}
+
+#endif /* LOGX_CALLSITE_H */
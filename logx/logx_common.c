@@ -8,6 +8,8 @@
  * @copyright Copyright (c) 2025
  */
 
+#define _GNU_SOURCE
+
 #include "logx_common.h"
 #include "logx.h"
 #include "logx_errorcodes.h"
@@ -17,34 +19,36 @@
 #include <string.h>
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
+#include <syslog.h>
+#include <unistd.h>
 
-/* Enum lookup tables — add/remove a row here to add/remove an enum value */
+/* Enum lookup tables, indexed by enum value — levels are added in logx_levels.def */
 const logx_level_entry_t LOGX_LEVEL_MAP[] = {
-    {LOGX_LEVEL_TRACE, "TRC", "TRACE", COLOR_BLUE},
-    {LOGX_LEVEL_DEBUG, "DBG", "DEBUG", COLOR_WHITE},
-    {LOGX_LEVEL_BANNER, "BNR", "BANNER", COLOR_CYAN},
-    {LOGX_LEVEL_INFO, "INF", "INFO", COLOR_GREEN},
-    {LOGX_LEVEL_WARN, "WRN", "WARN", COLOR_YELLOW},
-    {LOGX_LEVEL_ERROR, "ERR", "ERROR", COLOR_RED},
-    {LOGX_LEVEL_FATAL, "FTL", "FATAL", COLOR_MAGENTA},
-    {LOGX_LEVEL_OFF, "OFF", "OFF", COLOR_RESET},
+#define LOGX_LEVEL_DEF(name, tag, color, priority)                                                 \
+    [LOGX_LEVEL_##name] = {LOGX_LEVEL_##name, tag, #name, color, priority},
+#include "logx_levels.def"
+#undef LOGX_LEVEL_DEF
 };
 
 const size_t LOGX_LEVEL_MAP_COUNT = ARRAY_SIZE(LOGX_LEVEL_MAP);
 
 const logx_rotate_entry_t LOGX_ROTATE_MAP[] = {
-    {LOGX_ROTATE_NONE, "None", "NONE"},
-    {LOGX_ROTATE_BY_SIZE, "By Size", "BY_SIZE"},
-    {LOGX_ROTATE_BY_DATE, "By Date", "BY_DATE"},
+    [LOGX_ROTATE_NONE]    = {LOGX_ROTATE_NONE, "None", "NONE"},
+    [LOGX_ROTATE_BY_SIZE] = {LOGX_ROTATE_BY_SIZE, "By Size", "BY_SIZE"},
+    [LOGX_ROTATE_BY_DATE] = {LOGX_ROTATE_BY_DATE, "By Date", "BY_DATE"},
 };
 const size_t LOGX_ROTATE_MAP_COUNT = ARRAY_SIZE(LOGX_ROTATE_MAP);
 
 const logx_ts_fmt_entry_t LOGX_TS_FMT_MAP[] = {
-    {LOGX_TS_FMT_LOCAL, "LOCAL"},       {LOGX_TS_FMT_UTC, "UTC"},
-    {LOGX_TS_FMT_EPOCH_S, "EPOCH_S"},   {LOGX_TS_FMT_EPOCH_MS, "EPOCH_MS"},
-    {LOGX_TS_FMT_EPOCH_US, "EPOCH_US"}, {LOGX_TS_FMT_ISO8601, "ISO8601"},
-    {LOGX_TS_FMT_RFC2822, "RFC2822"},
+    [LOGX_TS_FMT_LOCAL]    = {LOGX_TS_FMT_LOCAL, "LOCAL"},
+    [LOGX_TS_FMT_UTC]      = {LOGX_TS_FMT_UTC, "UTC"},
+    [LOGX_TS_FMT_EPOCH_S]  = {LOGX_TS_FMT_EPOCH_S, "EPOCH_S"},
+    [LOGX_TS_FMT_EPOCH_MS] = {LOGX_TS_FMT_EPOCH_MS, "EPOCH_MS"},
+    [LOGX_TS_FMT_EPOCH_US] = {LOGX_TS_FMT_EPOCH_US, "EPOCH_US"},
+    [LOGX_TS_FMT_ISO8601]  = {LOGX_TS_FMT_ISO8601, "ISO8601"},
+    [LOGX_TS_FMT_RFC2822]  = {LOGX_TS_FMT_RFC2822, "RFC2822"},
 };
 const size_t LOGX_TS_FMT_MAP_COUNT = ARRAY_SIZE(LOGX_TS_FMT_MAP);
 
@@ -70,28 +74,48 @@ logx_errorcodes_t unlock_flock(int fd)
 
 logx_errorcodes_t is_valid_logx_rotate_type(logx_rotate_type_t eRotateType)
 {
-    for (size_t i = 0; i < LOGX_ROTATE_MAP_COUNT; i++)
-        if (LOGX_ROTATE_MAP[i].val == eRotateType)
-            return LOGX_ERR_SUCCESS;
+    if ((size_t)eRotateType < LOGX_ROTATE_MAP_COUNT)
+        return LOGX_ERR_SUCCESS;
     return LOGX_ERR_FAILURE;
 }
 
 logx_errorcodes_t is_valid_logx_level(logx_level_t eLogLevel)
 {
-    for (size_t i = 0; i < LOGX_LEVEL_MAP_COUNT; i++)
-        if (LOGX_LEVEL_MAP[i].val == eLogLevel)
-            return LOGX_ERR_SUCCESS;
+    if ((unsigned)eLogLevel < LOGX_LEVEL_COUNT)
+        return LOGX_ERR_SUCCESS;
     return LOGX_ERR_FAILURE;
 }
 
+const char *logx_level_to_string(logx_level_t eLogLevel)
+{
+    if ((unsigned)eLogLevel < LOGX_LEVEL_COUNT)
+        return LOGX_LEVEL_MAP[eLogLevel].abbr;
+    return "ukwn";
+}
+
 const char *logx_level_to_color(logx_level_t eLogLevel)
 {
-    for (size_t i = 0; i < LOGX_LEVEL_MAP_COUNT; i++)
-        if (LOGX_LEVEL_MAP[i].val == eLogLevel)
-            return LOGX_LEVEL_MAP[i].color;
+    if ((unsigned)eLogLevel < LOGX_LEVEL_COUNT)
+        return LOGX_LEVEL_MAP[eLogLevel].color;
     return COLOR_RESET;
 }
 
+int logx_level_to_syslog_priority(logx_level_t eLogLevel)
+{
+    if ((unsigned)eLogLevel < LOGX_LEVEL_COUNT)
+        return LOGX_LEVEL_MAP[eLogLevel].syslog_priority;
+    return LOG_DEBUG;
+}
+
+unsigned long logx_thread_id(void)
+{
+    static _Thread_local unsigned long tid = 0;
+
+    if (!tid)
+        tid = (unsigned long)syscall(SYS_gettid);
+    return tid;
+}
+
 const char *logx_check(int bEnable)
 {
     if (bEnable)
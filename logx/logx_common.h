@@ -36,10 +36,11 @@
 /** @brief Lookup-table row for a log level — maps enum value to display strings and colour. */
 typedef struct
 {
-    logx_level_t val;  /**< Enum value. */
-    const char *abbr;  /**< Short abbreviation used in log prefixes, e.g. `"TRC"`. */
-    const char *name;  /**< Full name used in config files, e.g. `"TRACE"`. */
-    const char *color; /**< ANSI escape code for this level. */
+    logx_level_t val;    /**< Enum value. */
+    const char *abbr;    /**< Short abbreviation used in log prefixes, e.g. `"TRC"`. */
+    const char *name;    /**< Full name used in config files, e.g. `"TRACE"`. */
+    const char *color;   /**< ANSI escape code for this level. */
+    int syslog_priority; /**< syslog priority records of this level are sent with. */
 } logx_level_entry_t;
 
 /** @brief Lookup-table row for a rotation type. */
@@ -57,9 +58,9 @@ typedef struct
     const char *name;  /**< Config-file name, e.g. `"ISO8601"`. */
 } logx_ts_fmt_entry_t;
 
-extern const logx_level_entry_t LOGX_LEVEL_MAP[];   /**< Level lookup table. */
-extern const logx_rotate_entry_t LOGX_ROTATE_MAP[]; /**< Rotation-type lookup table. */
-extern const logx_ts_fmt_entry_t LOGX_TS_FMT_MAP[]; /**< Timestamp-format lookup table. */
+extern const logx_level_entry_t LOGX_LEVEL_MAP[];   /**< Level lookup table, indexed by level. */
+extern const logx_rotate_entry_t LOGX_ROTATE_MAP[]; /**< Rotation-type table, indexed by value. */
+extern const logx_ts_fmt_entry_t LOGX_TS_FMT_MAP[]; /**< Timestamp-format table, indexed by value. */
 extern const size_t LOGX_LEVEL_MAP_COUNT;           /**< Number of rows in LOGX_LEVEL_MAP. */
 extern const size_t LOGX_ROTATE_MAP_COUNT;          /**< Number of rows in LOGX_ROTATE_MAP. */
 extern const size_t LOGX_TS_FMT_MAP_COUNT;          /**< Number of rows in LOGX_TS_FMT_MAP. */
@@ -98,6 +99,13 @@ const char *logx_level_to_string(logx_level_t eLogLevel);
  */
 const char *logx_level_to_color(logx_level_t eLogLevel);
 
+/**
+ * @brief Return the syslog priority records of a log level are sent with.
+ * @param[in] eLogLevel Log level enum value.
+ * @return `LOG_*` priority, or `LOG_DEBUG` if not found.
+ */
+int logx_level_to_syslog_priority(logx_level_t eLogLevel);
+
 /**
  * @brief Return the display string for a rotation type (e.g. `"By Size"`).
  * @param[in] eRotateType Rotation type enum value.
@@ -140,6 +148,15 @@ logx_errorcodes_t exclusive_flock(int fd);
  */
 logx_errorcodes_t unlock_flock(int fd);
 
+/**
+ * @brief Return the kernel thread ID of the calling thread.
+ *
+ * The value is fetched once per thread via `gettid` and cached in thread-local storage.
+ *
+ * @return Kernel thread ID (matches the TID shown by `ps -L` / `top -H`).
+ */
+unsigned long logx_thread_id(void);
+
 /**
  * @brief Ensure all parent directories for a file path exist, creating them if needed.
  * @param[in] path Full file path whose parent directories should be created.
@@ -123,6 +123,111 @@ const logx_field_desc_t LOGX_FIELD_TABLE[] = {
      LOGX_FIELD_STRING,
      offsetof(logx_cfg_t, syslog_ident),
      {.str_default = LOGX_DEFAULT_CFG_SYSLOG_IDENT}},
+    {LOGX_KEY_TIMER_LEVEL,
+     "logx",
+     LOGX_FIELD_LEVEL,
+     offsetof(logx_cfg_t, timer_level),
+     {.int_default = LOGX_DEFAULT_CFG_TIMER_LEVEL}},
+    {LOGX_KEY_TIMER_RESOURCE_USAGE,
+     "logx",
+     LOGX_FIELD_BOOL,
+     offsetof(logx_cfg_t, timer_resource_usage),
+     {.int_default = LOGX_DEFAULT_CFG_TIMER_RESOURCE_USAGE}},
+    {LOGX_KEY_SHED_RECORDS_PER_SEC,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, shed_records_per_sec),
+     {.int_default = LOGX_DEFAULT_CFG_SHED_RECORDS_PER_SEC}},
+    {LOGX_KEY_SHED_BYTES_PER_SEC,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, shed_bytes_per_sec),
+     {.int_default = LOGX_DEFAULT_CFG_SHED_BYTES_PER_SEC}},
+    {LOGX_KEY_DEDUP_WINDOW_MS,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, dedup_window_ms),
+     {.int_default = LOGX_DEFAULT_CFG_DEDUP_WINDOW_MS}},
+    {LOGX_KEY_CONTROL_SOCKET_PATH,
+     "logx",
+     LOGX_FIELD_STRING,
+     offsetof(logx_cfg_t, control_socket_path),
+     {.str_default = LOGX_DEFAULT_CFG_CONTROL_SOCKET_PATH}},
+    {LOGX_KEY_WATCH_CONFIG,
+     "logx",
+     LOGX_FIELD_BOOL,
+     offsetof(logx_cfg_t, watch_config),
+     {.int_default = LOGX_DEFAULT_CFG_WATCH_CONFIG}},
+    {LOGX_KEY_FILE_BUFFER_SIZE,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, file_buffer_size),
+     {.int_default = LOGX_DEFAULT_CFG_FILE_BUFFER_SIZE}},
+    {LOGX_KEY_FILE_DIRECT_IO,
+     "logx",
+     LOGX_FIELD_BOOL,
+     offsetof(logx_cfg_t, file_direct_io),
+     {.int_default = LOGX_DEFAULT_CFG_FILE_DIRECT_IO}},
+    {LOGX_KEY_FILE_ATOMIC_APPEND,
+     "logx",
+     LOGX_FIELD_BOOL,
+     offsetof(logx_cfg_t, file_atomic_append),
+     {.int_default = LOGX_DEFAULT_CFG_FILE_ATOMIC_APPEND}},
+    {LOGX_KEY_RECORDER_SIZE,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, recorder_size),
+     {.int_default = LOGX_DEFAULT_CFG_RECORDER_SIZE}},
+    {LOGX_KEY_RECORDER_LEVEL,
+     "logx",
+     LOGX_FIELD_LEVEL,
+     offsetof(logx_cfg_t, recorder_level),
+     {.int_default = LOGX_DEFAULT_CFG_RECORDER_LEVEL}},
+    {LOGX_KEY_RECORDER_PATH,
+     "logx",
+     LOGX_FIELD_STRING,
+     offsetof(logx_cfg_t, recorder_path),
+     {.str_default = LOGX_DEFAULT_CFG_RECORDER_PATH}},
+    {LOGX_KEY_BACKFILL_SIZE,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, backfill_size),
+     {.int_default = LOGX_DEFAULT_CFG_BACKFILL_SIZE}},
+    {LOGX_KEY_BACKFILL_LEVEL,
+     "logx",
+     LOGX_FIELD_LEVEL,
+     offsetof(logx_cfg_t, backfill_level),
+     {.int_default = LOGX_DEFAULT_CFG_BACKFILL_LEVEL}},
+    {LOGX_KEY_BACKFILL_TRIGGER_LEVEL,
+     "logx",
+     LOGX_FIELD_LEVEL,
+     offsetof(logx_cfg_t, backfill_trigger_level),
+     {.int_default = LOGX_DEFAULT_CFG_BACKFILL_TRIGGER_LEVEL}},
+    {LOGX_KEY_SHM_NAME,
+     "logx",
+     LOGX_FIELD_STRING,
+     offsetof(logx_cfg_t, shm_name),
+     {.str_default = LOGX_DEFAULT_CFG_SHM_NAME}},
+    {LOGX_KEY_SHM_RING_SIZE,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, shm_ring_size),
+     {.int_default = LOGX_DEFAULT_CFG_SHM_RING_SIZE}},
+    {LOGX_KEY_SHM_RINGS,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, shm_rings),
+     {.int_default = LOGX_DEFAULT_CFG_SHM_RINGS}},
+    {LOGX_KEY_MAX_MESSAGE_SIZE,
+     "logx",
+     LOGX_FIELD_INT,
+     offsetof(logx_cfg_t, max_message_size),
+     {.int_default = LOGX_DEFAULT_CFG_MAX_MESSAGE_SIZE}},
+    {LOGX_KEY_LAYOUT_PATTERN,
+     "logx",
+     LOGX_FIELD_STRING,
+     offsetof(logx_cfg_t, layout_pattern),
+     {.str_default = LOGX_DEFAULT_CFG_LAYOUT_PATTERN}},
 };
 //clang-format on
 
@@ -199,27 +304,17 @@ void logx_cfg_print(const logx_cfg_t *cfg)
     printf("\n");
 }
 
-const char *logx_level_to_string(logx_level_t eLogLevel)
-{
-    for (size_t i = 0; i < LOGX_LEVEL_MAP_COUNT; i++)
-        if (LOGX_LEVEL_MAP[i].val == eLogLevel)
-            return LOGX_LEVEL_MAP[i].abbr;
-    return "ukwn";
-}
-
 const char *logx_rotate_type_to_string(logx_rotate_type_t eRotateType)
 {
-    for (size_t i = 0; i < LOGX_ROTATE_MAP_COUNT; i++)
-        if (LOGX_ROTATE_MAP[i].val == eRotateType)
-            return LOGX_ROTATE_MAP[i].disp;
+    if ((size_t)eRotateType < LOGX_ROTATE_MAP_COUNT)
+        return LOGX_ROTATE_MAP[eRotateType].disp;
     return "ukwn";
 }
 
 const char *logx_ts_fmt_to_string(logx_ts_fmt_t eTsFormat)
 {
-    for (size_t i = 0; i < LOGX_TS_FMT_MAP_COUNT; i++)
-        if (LOGX_TS_FMT_MAP[i].val == eTsFormat)
-            return LOGX_TS_FMT_MAP[i].name;
+    if ((size_t)eTsFormat < LOGX_TS_FMT_MAP_COUNT)
+        return LOGX_TS_FMT_MAP[eTsFormat].name;
     return "ukwn";
 }
 
@@ -283,20 +378,25 @@ typedef struct
     const char *name;
 } logx_syslog_facility_entry_t;
 
-static const logx_syslog_facility_entry_t SYSLOG_FACILITY_MAP[] = {
-    {LOGX_SYSLOG_FACILITY_USER, "USER"},     {LOGX_SYSLOG_FACILITY_DAEMON, "DAEMON"},
-    {LOGX_SYSLOG_FACILITY_LOCAL0, "LOCAL0"}, {LOGX_SYSLOG_FACILITY_LOCAL1, "LOCAL1"},
-    {LOGX_SYSLOG_FACILITY_LOCAL2, "LOCAL2"}, {LOGX_SYSLOG_FACILITY_LOCAL3, "LOCAL3"},
-    {LOGX_SYSLOG_FACILITY_LOCAL4, "LOCAL4"}, {LOGX_SYSLOG_FACILITY_LOCAL5, "LOCAL5"},
-    {LOGX_SYSLOG_FACILITY_LOCAL6, "LOCAL6"}, {LOGX_SYSLOG_FACILITY_LOCAL7, "LOCAL7"},
+/* Indexed by facility number (`LOG_FAC()`); unused facilities have no name */
+static const logx_syslog_facility_entry_t SYSLOG_FACILITY_MAP[LOG_NFACILITIES] = {
+    [LOG_FAC(LOG_USER)]   = {LOGX_SYSLOG_FACILITY_USER, "USER"},
+    [LOG_FAC(LOG_DAEMON)] = {LOGX_SYSLOG_FACILITY_DAEMON, "DAEMON"},
+    [LOG_FAC(LOG_LOCAL0)] = {LOGX_SYSLOG_FACILITY_LOCAL0, "LOCAL0"},
+    [LOG_FAC(LOG_LOCAL1)] = {LOGX_SYSLOG_FACILITY_LOCAL1, "LOCAL1"},
+    [LOG_FAC(LOG_LOCAL2)] = {LOGX_SYSLOG_FACILITY_LOCAL2, "LOCAL2"},
+    [LOG_FAC(LOG_LOCAL3)] = {LOGX_SYSLOG_FACILITY_LOCAL3, "LOCAL3"},
+    [LOG_FAC(LOG_LOCAL4)] = {LOGX_SYSLOG_FACILITY_LOCAL4, "LOCAL4"},
+    [LOG_FAC(LOG_LOCAL5)] = {LOGX_SYSLOG_FACILITY_LOCAL5, "LOCAL5"},
+    [LOG_FAC(LOG_LOCAL6)] = {LOGX_SYSLOG_FACILITY_LOCAL6, "LOCAL6"},
+    [LOG_FAC(LOG_LOCAL7)] = {LOGX_SYSLOG_FACILITY_LOCAL7, "LOCAL7"},
 };
 #define SYSLOG_FACILITY_MAP_COUNT ARRAY_SIZE(SYSLOG_FACILITY_MAP)
 
 static const char *logx_syslog_facility_to_string(logx_syslog_facility_t val)
 {
-    for (size_t i = 0; i < SYSLOG_FACILITY_MAP_COUNT; i++)
-        if (SYSLOG_FACILITY_MAP[i].val == val)
-            return SYSLOG_FACILITY_MAP[i].name;
+    if (((unsigned)val & ~LOG_FACMASK) == 0 && SYSLOG_FACILITY_MAP[LOG_FAC(val)].name)
+        return SYSLOG_FACILITY_MAP[LOG_FAC(val)].name;
     return "ukwn";
 }
 
@@ -306,7 +406,7 @@ static logx_syslog_facility_t logx_syslog_facility_from_str(const char *str,
     if (!str)
         return fallback;
     for (size_t i = 0; i < SYSLOG_FACILITY_MAP_COUNT; i++)
-        if (strcasecmp(str, SYSLOG_FACILITY_MAP[i].name) == 0)
+        if (SYSLOG_FACILITY_MAP[i].name && strcasecmp(str, SYSLOG_FACILITY_MAP[i].name) == 0)
             return SYSLOG_FACILITY_MAP[i].val;
     fprintf(stderr, "[LogX] Unknown syslog_facility '%s', using default.\n", str);
     return fallback;
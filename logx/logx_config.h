@@ -100,6 +100,90 @@
 #define LOGX_DEFAULT_CFG_SYSLOG_IDENT NULL
 #endif
 
+#ifndef LOGX_DEFAULT_CFG_TIMER_LEVEL
+#define LOGX_DEFAULT_CFG_TIMER_LEVEL LOGX_LEVEL_INFO
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_TIMER_RESOURCE_USAGE
+#define LOGX_DEFAULT_CFG_TIMER_RESOURCE_USAGE 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_SHED_RECORDS_PER_SEC
+#define LOGX_DEFAULT_CFG_SHED_RECORDS_PER_SEC 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_SHED_BYTES_PER_SEC
+#define LOGX_DEFAULT_CFG_SHED_BYTES_PER_SEC 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_DEDUP_WINDOW_MS
+#define LOGX_DEFAULT_CFG_DEDUP_WINDOW_MS 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_CONTROL_SOCKET_PATH
+#define LOGX_DEFAULT_CFG_CONTROL_SOCKET_PATH NULL
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_WATCH_CONFIG
+#define LOGX_DEFAULT_CFG_WATCH_CONFIG 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_FILE_BUFFER_SIZE
+#define LOGX_DEFAULT_CFG_FILE_BUFFER_SIZE 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_FILE_DIRECT_IO
+#define LOGX_DEFAULT_CFG_FILE_DIRECT_IO 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_FILE_ATOMIC_APPEND
+#define LOGX_DEFAULT_CFG_FILE_ATOMIC_APPEND 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_RECORDER_SIZE
+#define LOGX_DEFAULT_CFG_RECORDER_SIZE 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_RECORDER_LEVEL
+#define LOGX_DEFAULT_CFG_RECORDER_LEVEL LOGX_LEVEL_TRACE
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_RECORDER_PATH
+#define LOGX_DEFAULT_CFG_RECORDER_PATH NULL
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_BACKFILL_SIZE
+#define LOGX_DEFAULT_CFG_BACKFILL_SIZE 0
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_BACKFILL_LEVEL
+#define LOGX_DEFAULT_CFG_BACKFILL_LEVEL LOGX_LEVEL_INFO
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_BACKFILL_TRIGGER_LEVEL
+#define LOGX_DEFAULT_CFG_BACKFILL_TRIGGER_LEVEL LOGX_LEVEL_ERROR
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_MAX_MESSAGE_SIZE
+#define LOGX_DEFAULT_CFG_MAX_MESSAGE_SIZE (1024 * 1024)
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_LAYOUT_PATTERN
+#define LOGX_DEFAULT_CFG_LAYOUT_PATTERN NULL
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_SHM_NAME
+#define LOGX_DEFAULT_CFG_SHM_NAME NULL
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_SHM_RING_SIZE
+#define LOGX_DEFAULT_CFG_SHM_RING_SIZE (1024 * 1024)
+#endif
+
+#ifndef LOGX_DEFAULT_CFG_SHM_RINGS
+#define LOGX_DEFAULT_CFG_SHM_RINGS 64
+#endif
+
 /* Default LogX Configuration file paths */
 #define LOGX_DEFAULT_CFG_YML_FILEPATH  "./logx_cfg.yml"
 #define LOGX_DEFAULT_CFG_YAML_FILEPATH "./logx_cfg.yaml"
@@ -125,6 +209,27 @@
 #define LOGX_KEY_ENABLE_SYSLOG          "enable_syslog"
 #define LOGX_KEY_SYSLOG_FACILITY        "syslog_facility"
 #define LOGX_KEY_SYSLOG_IDENT           "syslog_ident"
+#define LOGX_KEY_TIMER_LEVEL            "timer_level"
+#define LOGX_KEY_TIMER_RESOURCE_USAGE   "timer_resource_usage"
+#define LOGX_KEY_SHED_RECORDS_PER_SEC   "shed_records_per_sec"
+#define LOGX_KEY_SHED_BYTES_PER_SEC     "shed_bytes_per_sec"
+#define LOGX_KEY_DEDUP_WINDOW_MS        "dedup_window_ms"
+#define LOGX_KEY_CONTROL_SOCKET_PATH    "control_socket_path"
+#define LOGX_KEY_WATCH_CONFIG           "watch_config"
+#define LOGX_KEY_FILE_BUFFER_SIZE       "file_buffer_size"
+#define LOGX_KEY_FILE_DIRECT_IO         "file_direct_io"
+#define LOGX_KEY_FILE_ATOMIC_APPEND     "file_atomic_append"
+#define LOGX_KEY_RECORDER_SIZE          "recorder_size"
+#define LOGX_KEY_RECORDER_LEVEL         "recorder_level"
+#define LOGX_KEY_RECORDER_PATH          "recorder_path"
+#define LOGX_KEY_BACKFILL_SIZE          "backfill_size"
+#define LOGX_KEY_BACKFILL_LEVEL         "backfill_level"
+#define LOGX_KEY_BACKFILL_TRIGGER_LEVEL "backfill_trigger_level"
+#define LOGX_KEY_SHM_NAME               "shm_name"
+#define LOGX_KEY_SHM_RING_SIZE          "shm_ring_size"
+#define LOGX_KEY_SHM_RINGS              "shm_rings"
+#define LOGX_KEY_MAX_MESSAGE_SIZE       "max_message_size"
+#define LOGX_KEY_LAYOUT_PATTERN         "layout_pattern"
 
 /**
  * @brief Descriptor for a single configuration field.
@@ -164,6 +269,18 @@ void log_missing_json_keys(cJSON *root);
  */
 void logx_cfg_print(const logx_cfg_t *cfg);
 
+/**
+ * @brief Parse a YAML (`.yml`/`.yaml`) or JSON (`.json`) configuration file.
+ *
+ * Every field of `cfg` is written: keys missing from the file get their default.
+ * String fields are heap-allocated; on failure they are freed again.
+ *
+ * @param[in]  filepath Path to the configuration file.
+ * @param[out] cfg      Zero-initialised structure to populate.
+ * @return `LOGX_ERR_SUCCESS` on success, error otherwise.
+ */
+logx_errorcodes_t logx_parse_config_file(const char *filepath, logx_cfg_t *cfg);
+
 /**
  * @brief Apply a parsed value (or its default) to the correct field in `cfg`.
  *
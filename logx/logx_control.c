@@ -0,0 +1,894 @@
+/**
+ * @file logx_control.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Local control socket — background thread and command interpreter.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* accept4, pthread_setname_np */
+
+#include "logx_control.h"
+#include "logx.h"
+#include "logx_callsite.h"
+#include "logx_common.h"
+#include "logx_rotation.h"
+#include "logx_string_maps.h"
+#include "logx_time.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/** @brief Maximum number of loggers reachable through the control socket. */
+#define LOGX_CONTROL_MAX_LOGGERS 32
+
+/** @brief Maximum length of one command line, including the newline. */
+#define LOGX_CONTROL_LINE_MAX 512
+
+/** @brief Size of the reply buffer for one command. */
+#define LOGX_CONTROL_REPLY_MAX 8192
+
+/** @brief Maximum number of clients connected at the same time. */
+#define LOGX_CONTROL_MAX_CLIENTS 8
+
+/** @brief A client is disconnected this long after it connected, busy or not. */
+#define LOGX_CONTROL_CLIENT_TIMEOUT_MS 5000
+
+/**
+ * @brief A logger reachable through the control socket.
+ */
+typedef struct
+{
+    logx_t *logger; /**< Attached logger. */
+    int pins;       /**< Commands running on it. */
+    int detaching;  /**< 1 once `logx_control_detach()` waits for its commands. */
+} ctl_entry_t;
+
+/* Lifecycle (start/stop of the thread) is serialised by g_ctl_life. g_ctl_lock
+ * only guards the logger list: a command pins the loggers it runs on and runs
+ * without the lock, and detaching a logger waits for its pins to drop. */
+static pthread_mutex_t g_ctl_life    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t g_ctl_lock    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_ctl_unpinned = PTHREAD_COND_INITIALIZER;
+static ctl_entry_t g_ctl_loggers[LOGX_CONTROL_MAX_LOGGERS];
+static int g_ctl_count      = 0;
+static int g_ctl_running    = 0;
+static int g_ctl_listen_fd  = -1;
+static int g_ctl_wake_fd[2] = {-1, -1};
+static pthread_t g_ctl_thread;
+static char g_ctl_path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+
+/**
+ * @brief Growable-by-truncation reply buffer for one command.
+ */
+typedef struct
+{
+    char buf[LOGX_CONTROL_REPLY_MAX]; /**< Reply text. */
+    size_t len;                       /**< Bytes used. */
+} ctl_reply_t;
+
+/**
+ * @brief Append printf-style text to a reply, truncating silently when full.
+ */
+__attribute__((format(printf, 2, 3))) static void reply_add(ctl_reply_t *r, const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    if (r->len >= sizeof(r->buf) - 1)
+        return;
+
+    va_start(ap, fmt);
+    n = vsnprintf(r->buf + r->len, sizeof(r->buf) - r->len, fmt, ap);
+    va_end(ap);
+
+    if (n > 0)
+        r->len += ((size_t)n < sizeof(r->buf) - r->len) ? (size_t)n : sizeof(r->buf) - r->len - 1;
+}
+
+/**
+ * @brief Parse a level name as used in config files (`TRACE` … `OFF`), case-insensitively.
+ *
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_VALUE` if unknown.
+ */
+static logx_errorcodes_t parse_level(const char *s, logx_level_t *out)
+{
+    for (size_t i = 0; s && i < LOGX_LEVEL_MAP_COUNT; i++)
+    {
+        if (!strcasecmp(s, LOGX_LEVEL_MAP[i].name) || !strcasecmp(s, LOGX_LEVEL_MAP[i].abbr))
+        {
+            *out = LOGX_LEVEL_MAP[i].val;
+            return LOGX_ERR_SUCCESS;
+        }
+    }
+    return LOGX_ERR_INVALID_VALUE;
+}
+
+/**
+ * @brief Parse `on`/`off` (also `1`/`0`, `true`/`false`).
+ *
+ * @return 1 or 0, or -1 if unknown.
+ */
+static int parse_onoff(const char *s)
+{
+    if (!s)
+        return -1;
+    if (!strcasecmp(s, "on") || !strcmp(s, "1") || !strcasecmp(s, "true"))
+        return 1;
+    if (!strcasecmp(s, "off") || !strcmp(s, "0") || !strcasecmp(s, "false"))
+        return 0;
+    return -1;
+}
+
+/**
+ * @brief Parse a non-negative decimal integer.
+ *
+ * @return 0 on success, -1 otherwise.
+ */
+static int parse_uint(const char *s, int *out)
+{
+    char *end = NULL;
+    long v;
+
+    if (!s || !*s)
+        return -1;
+
+    errno = 0;
+    v     = strtol(s, &end, 10);
+    if (errno || *end || v < 0 || v > 0x7fffffffL)
+        return -1;
+
+    *out = (int)v;
+    return 0;
+}
+
+/**
+ * @brief Signature of a per-logger command body.
+ *
+ * @param[in]     logger Target logger.
+ * @param[in]     argv   Command arguments after the logger name.
+ * @param[in]     argc   Number of arguments.
+ * @param[in,out] r      Reply buffer.
+ * @return `LOGX_ERR_SUCCESS` or an error to report.
+ */
+typedef logx_errorcodes_t (*ctl_logger_cmd_t)(logx_t *logger, char **argv, int argc,
+                                              ctl_reply_t *r);
+
+/**
+ * @brief Index of an attached logger in `g_ctl_loggers`. Called with `g_ctl_lock` held.
+ * @return The index, or -1.
+ */
+static int ctl_find(const logx_t *logger)
+{
+    for (int i = 0; i < g_ctl_count; i++)
+    {
+        if (g_ctl_loggers[i].logger == logger)
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Run `cmd` on every attached logger matching `target` (a name or `*`).
+ *
+ * The matching loggers are pinned, so the command runs without `g_ctl_lock` and
+ * none of them can be detached until it is done.
+ */
+static void for_each_target(const char *target, ctl_logger_cmd_t cmd, char **argv, int argc,
+                            ctl_reply_t *r)
+{
+    logx_t *targets[LOGX_CONTROL_MAX_LOGGERS];
+    int matched = 0;
+
+    if (!target)
+    {
+        reply_add(r, "ERR missing logger name (or '*')\n");
+        return;
+    }
+
+    pthread_mutex_lock(&g_ctl_lock);
+    for (int i = 0; i < g_ctl_count; i++)
+    {
+        ctl_entry_t *e   = &g_ctl_loggers[i];
+        const char *name = e->logger->cfg.name ? e->logger->cfg.name : "";
+
+        if (e->detaching || (strcmp(target, "*") != 0 && strcmp(target, name) != 0))
+            continue;
+
+        e->pins++;
+        targets[matched++] = e->logger;
+    }
+    pthread_mutex_unlock(&g_ctl_lock);
+
+    for (int i = 0; i < matched; i++)
+    {
+        const char *name       = targets[i]->cfg.name ? targets[i]->cfg.name : "";
+        logx_errorcodes_t eErr = cmd(targets[i], argv, argc, r);
+
+        if (eErr == LOGX_ERR_SUCCESS)
+            reply_add(r, "OK %s\n", name);
+        else
+            reply_add(r, "ERR %s: %s\n", name, logx_get_err_string(eErr));
+    }
+
+    if (!matched)
+    {
+        reply_add(r, "ERR no logger named '%s'\n", target);
+        return;
+    }
+
+    pthread_mutex_lock(&g_ctl_lock);
+    for (int i = 0; i < matched; i++)
+        g_ctl_loggers[ctl_find(targets[i])].pins--;
+    pthread_cond_broadcast(&g_ctl_unpinned);
+    pthread_mutex_unlock(&g_ctl_lock);
+}
+
+/** @brief `level <logger> console|file|timer <LEVEL>` */
+static logx_errorcodes_t cmd_level(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    logx_level_t level;
+
+    (void)r;
+    if (argc != 2 || parse_level(argv[1], &level) != LOGX_ERR_SUCCESS)
+        return LOGX_ERR_INVALID_ARG;
+
+    if (!strcasecmp(argv[0], "console"))
+        return logx_set_console_logging_level(logger, level);
+    if (!strcasecmp(argv[0], "file"))
+        return logx_set_file_logging_level(logger, level);
+    if (!strcasecmp(argv[0], "timer"))
+        return logx_set_timer_level(logger, level);
+    return LOGX_ERR_INVALID_ARG;
+}
+
+/** @brief `sink <logger> console|file|syslog|color on|off` */
+static logx_errorcodes_t cmd_sink(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    int on = (argc == 2) ? parse_onoff(argv[1]) : -1;
+
+    (void)r;
+    if (on < 0)
+        return LOGX_ERR_INVALID_ARG;
+
+    if (!strcasecmp(argv[0], "console"))
+        return on ? logx_enable_console_logging(logger) : logx_disable_console_logging(logger);
+    if (!strcasecmp(argv[0], "file"))
+        return on ? logx_enable_file_logging(logger) : logx_disable_file_logging(logger);
+    if (!strcasecmp(argv[0], "syslog"))
+        return on ? logx_enable_syslog(logger) : logx_disable_syslog(logger);
+    if (!strcasecmp(argv[0], "color"))
+        return on ? logx_enable_colored_logging(logger) : logx_disable_colored_logging(logger);
+    return LOGX_ERR_INVALID_ARG;
+}
+
+/** @brief `rotate <logger>` */
+static logx_errorcodes_t cmd_rotate(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    (void)argv;
+    (void)r;
+    if (argc != 0)
+        return LOGX_ERR_INVALID_ARG;
+    return logx_rotate_now(logger);
+}
+
+/** @brief `reload <logger> [path]` */
+static logx_errorcodes_t cmd_reload(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    (void)r;
+    if (argc > 1)
+        return LOGX_ERR_INVALID_ARG;
+    return logx_reload_config(logger, argc ? argv[0] : NULL);
+}
+
+/** @brief `dedup <logger> <window_ms>` */
+static logx_errorcodes_t cmd_dedup(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    int ms;
+
+    (void)r;
+    if (argc != 1 || parse_uint(argv[0], &ms) != 0)
+        return LOGX_ERR_INVALID_ARG;
+    return logx_set_dedup_window_ms(logger, ms);
+}
+
+/** @brief `shed <logger> <records_per_sec> <bytes_per_sec>` */
+static logx_errorcodes_t cmd_shed(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    int rps, bps;
+
+    (void)r;
+    if (argc != 2 || parse_uint(argv[0], &rps) != 0 || parse_uint(argv[1], &bps) != 0)
+        return LOGX_ERR_INVALID_ARG;
+    return logx_set_shed_budget(logger, rps, bps);
+}
+
+/** @brief `stats <logger>` */
+static logx_errorcodes_t cmd_stats(logx_t *logger, char **argv, int argc, ctl_reply_t *r)
+{
+    logx_stats_t stats;
+    struct stat st;
+    long long size = -1;
+
+    (void)argv;
+    if (argc != 0)
+        return LOGX_ERR_INVALID_ARG;
+
+    logx_get_stats(logger, &stats);
+
+    pthread_mutex_lock(&logger->lock);
+    logx_file_sink_lock(logger);
+    if (logger->fd >= 0 && fstat(logger->fd, &st) == 0)
+        size = (long long)st.st_size;
+    logx_file_sink_unlock(logger);
+
+    reply_add(r,
+              "name=%s console=%s/%s file=%s/%s syslog=%s timer_level=%s file_path=%s "
+              "file_size=%lld timers=%d dedup_window_ms=%d shed_step=%d records=%llu bytes=%llu "
+              "shed=%llu collapsed=%llu truncated=%llu write_errors=%llu\n",
+              logger->cfg.name ? logger->cfg.name : "",
+              logger->cfg.enable_console_logging ? "on" : "off",
+              logx_level_to_string(logger->cfg.console_level),
+              logger->cfg.enable_file_logging ? "on" : "off",
+              logx_level_to_string(logger->cfg.file_level),
+              logger->cfg.enable_syslog ? "on" : "off",
+              logx_level_to_string(logger->cfg.timer_level),
+              logger->cfg.file_path ? logger->cfg.file_path : "-", size,
+              __atomic_load_n(&logger->timers.count, __ATOMIC_RELAXED),
+              logger->cfg.dedup_window_ms, __atomic_load_n(&logger->shed.step, __ATOMIC_RELAXED),
+              (unsigned long long)stats.records, (unsigned long long)stats.bytes,
+              (unsigned long long)stats.shed, (unsigned long long)stats.collapsed,
+              (unsigned long long)stats.truncated, (unsigned long long)stats.write_errors);
+    pthread_mutex_unlock(&logger->lock);
+
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief `site on|off|default <file_glob|-> [func_glob|-] [line_min[-line_max]]`
+ */
+static void cmd_site(char **argv, int argc, ctl_reply_t *r)
+{
+    logx_callsite_state_t state;
+    const char *file_glob = NULL;
+    const char *func_glob = NULL;
+    int line_min          = 0;
+    int line_max          = 0;
+    int matched           = 0;
+
+    if (argc < 2 || argc > 4)
+        goto USAGE;
+
+    if (!strcasecmp(argv[0], "on"))
+        state = LOGX_CALLSITE_ON;
+    else if (!strcasecmp(argv[0], "off"))
+        state = LOGX_CALLSITE_OFF;
+    else if (!strcasecmp(argv[0], "default"))
+        state = LOGX_CALLSITE_DEFAULT;
+    else
+        goto USAGE;
+
+    if (strcmp(argv[1], "-") != 0)
+        file_glob = argv[1];
+    if (argc > 2 && strcmp(argv[2], "-") != 0)
+        func_glob = argv[2];
+    if (argc > 3)
+    {
+        char *dash = strchr(argv[3], '-');
+
+        if (dash)
+            *dash++ = '\0';
+        if (parse_uint(argv[3], &line_min) != 0)
+            goto USAGE;
+        line_max = line_min;
+        if (dash && parse_uint(dash, &line_max) != 0)
+            goto USAGE;
+    }
+
+    if (logx_callsite_set(file_glob, func_glob, line_min, line_max, state, &matched) !=
+        LOGX_ERR_SUCCESS)
+        goto USAGE;
+
+    reply_add(r, "OK %d sites\n", matched);
+    return;
+
+USAGE:
+    reply_add(r, "ERR usage: site on|off|default <file_glob|-> [func_glob|-] [line[-line]]\n");
+}
+
+/** @brief Reply to `help`. */
+static void cmd_help(ctl_reply_t *r)
+{
+    reply_add(r, "OK commands:\n"
+                 "  list\n"
+                 "  stats <logger|*>\n"
+                 "  level <logger|*> console|file|timer <LEVEL>\n"
+                 "  sink <logger|*> console|file|syslog|color on|off\n"
+                 "  rotate <logger|*>\n"
+                 "  reload <logger|*> [path]\n"
+                 "  dedup <logger|*> <window_ms>\n"
+                 "  shed <logger|*> <records_per_sec> <bytes_per_sec>\n"
+                 "  site on|off|default <file_glob|-> [func_glob|-] [line[-line]]\n");
+}
+
+/**
+ * @brief A command that runs on the loggers named by its first argument.
+ */
+typedef struct
+{
+    const char *name;     /**< Command word. */
+    ctl_logger_cmd_t cmd; /**< Handler run per matching logger. */
+    const char *usage;    /**< Usage line, replied when the logger name is missing. */
+} ctl_target_cmd_t;
+
+/** @brief Commands taking `<logger|*>`, except `stats` whose target is optional. */
+static const ctl_target_cmd_t g_ctl_target_cmds[] = {
+    {"level", cmd_level, "level <logger|*> console|file|timer <LEVEL>"},
+    {"sink", cmd_sink, "sink <logger|*> console|file|syslog|color on|off"},
+    {"rotate", cmd_rotate, "rotate <logger|*>"},
+    {"reload", cmd_reload, "reload <logger|*> [path]"},
+    {"dedup", cmd_dedup, "dedup <logger|*> <window_ms>"},
+    {"shed", cmd_shed, "shed <logger|*> <records_per_sec> <bytes_per_sec>"},
+};
+
+/**
+ * @brief Execute one command line and append the reply.
+ */
+static void execute_line(char *line, ctl_reply_t *r)
+{
+    char *argv[8] = {0};
+    int argc      = 0;
+    char *saveptr = NULL;
+    char *tok     = strtok_r(line, " \t\r", &saveptr);
+
+    while (tok && argc < 8)
+    {
+        argv[argc++] = tok;
+        tok          = strtok_r(NULL, " \t\r", &saveptr);
+    }
+
+    if (argc == 0)
+        return;
+
+    if (!strcasecmp(argv[0], "help"))
+        cmd_help(r);
+    else if (!strcasecmp(argv[0], "list"))
+    {
+        int listed = 0;
+
+        pthread_mutex_lock(&g_ctl_lock);
+        for (int i = 0; i < g_ctl_count; i++)
+        {
+            const logx_t *logger = g_ctl_loggers[i].logger;
+
+            if (g_ctl_loggers[i].detaching)
+                continue;
+            reply_add(r, "%s\n", logger->cfg.name ? logger->cfg.name : "");
+            listed++;
+        }
+        pthread_mutex_unlock(&g_ctl_lock);
+        reply_add(r, "OK %d loggers\n", listed);
+    }
+    else if (!strcasecmp(argv[0], "stats"))
+        for_each_target(argc > 1 ? argv[1] : "*", cmd_stats, argv + 2, argc > 2 ? argc - 2 : 0, r);
+    else if (!strcasecmp(argv[0], "site"))
+        cmd_site(argv + 1, argc - 1, r);
+    else
+    {
+        for (size_t i = 0; i < ARRAY_SIZE(g_ctl_target_cmds); i++)
+        {
+            const ctl_target_cmd_t *c = &g_ctl_target_cmds[i];
+
+            if (strcasecmp(argv[0], c->name) != 0)
+                continue;
+            if (argc < 2)
+                reply_add(r, "ERR usage: %s\n", c->usage);
+            else
+                for_each_target(argv[1], c->cmd, argv + 2, argc - 2, r);
+            return;
+        }
+        reply_add(r, "ERR unknown command '%s' (try 'help')\n", argv[0]);
+    }
+}
+
+/**
+ * @brief One connected client of the control thread.
+ */
+typedef struct
+{
+    int fd;                           /**< Connection, or -1 if the slot is free. */
+    uint64_t deadline_ms;             /**< Monotonic time at which it is disconnected. */
+    size_t used;                      /**< Bytes in `line`. */
+    char line[LOGX_CONTROL_LINE_MAX]; /**< Command line received so far. */
+} ctl_client_t;
+
+/** @brief Monotonic time in milliseconds. */
+static uint64_t ctl_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+/**
+ * @brief Write a whole buffer to a client before its deadline.
+ * @return 0 on success, -1 if the peer went away or stopped reading.
+ */
+static int send_all(const ctl_client_t *c, const char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = send(c->fd, buf, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            uint64_t now     = ctl_now_ms();
+            struct pollfd pf = {.fd = c->fd, .events = POLLOUT};
+
+            if (now >= c->deadline_ms || poll(&pf, 1, (int)(c->deadline_ms - now)) == 0)
+                return -1;
+            continue;
+        }
+        if (n <= 0)
+            return -1;
+        buf += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief Read what a client sent and execute every complete line.
+ * @return 1 to keep the client, 0 to disconnect it.
+ */
+static int ctl_client_read(ctl_client_t *c, ctl_reply_t *reply)
+{
+    ssize_t n = recv(c->fd, c->line + c->used, sizeof(c->line) - 1 - c->used, 0);
+
+    if (n < 0)
+        return errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK;
+    if (n == 0)
+        return 0;
+    c->used += (size_t)n;
+
+    char *nl;
+    while ((nl = memchr(c->line, '\n', c->used)) != NULL)
+    {
+        size_t consumed = (size_t)(nl - c->line) + 1;
+
+        *nl           = '\0';
+        reply->len    = 0;
+        reply->buf[0] = '\0';
+
+        execute_line(c->line, reply);
+        if (send_all(c, reply->buf, reply->len) != 0)
+            return 0;
+
+        memmove(c->line, c->line + consumed, c->used - consumed);
+        c->used -= consumed;
+    }
+
+    if (c->used == sizeof(c->line) - 1)
+    {
+        static const char too_long[] = "ERR line too long\n";
+        send_all(c, too_long, sizeof(too_long) - 1);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Take a pending connection, or turn it away when every slot is in use.
+ */
+static void ctl_client_accept(ctl_client_t *clients)
+{
+    int fd = accept4(g_ctl_listen_fd, NULL, NULL, SOCK_CLOEXEC | SOCK_NONBLOCK);
+
+    if (fd < 0)
+        return;
+
+    for (int i = 0; i < LOGX_CONTROL_MAX_CLIENTS; i++)
+    {
+        if (clients[i].fd >= 0)
+            continue;
+        clients[i].fd          = fd;
+        clients[i].deadline_ms = ctl_now_ms() + LOGX_CONTROL_CLIENT_TIMEOUT_MS;
+        clients[i].used        = 0;
+        return;
+    }
+
+    static const char busy[] = "ERR too many clients\n";
+    send(fd, busy, sizeof(busy) - 1, MSG_NOSIGNAL);
+    close(fd);
+}
+
+/**
+ * @brief Control thread: serve every connected client and accept new ones until
+ *        woken through the wake pipe.
+ *
+ * Each client has an absolute deadline, so no client can keep a slot for longer
+ * than `LOGX_CONTROL_CLIENT_TIMEOUT_MS`.
+ */
+static void *control_thread(void *arg)
+{
+    ctl_client_t *clients = calloc(LOGX_CONTROL_MAX_CLIENTS, sizeof(*clients));
+    ctl_reply_t *reply    = malloc(sizeof(*reply));
+
+    (void)arg;
+
+    if (!clients || !reply)
+        goto END;
+    for (int i = 0; i < LOGX_CONTROL_MAX_CLIENTS; i++)
+        clients[i].fd = -1;
+
+    for (;;)
+    {
+        struct pollfd pfd[2 + LOGX_CONTROL_MAX_CLIENTS];
+        int owner[2 + LOGX_CONTROL_MAX_CLIENTS];
+        int nfds     = 2;
+        int timeout  = -1;
+        uint64_t now = ctl_now_ms();
+
+        pfd[0] = (struct pollfd){.fd = g_ctl_listen_fd, .events = POLLIN};
+        pfd[1] = (struct pollfd){.fd = g_ctl_wake_fd[0], .events = POLLIN};
+
+        for (int i = 0; i < LOGX_CONTROL_MAX_CLIENTS; i++)
+        {
+            ctl_client_t *c = &clients[i];
+
+            if (c->fd < 0)
+                continue;
+            if (now >= c->deadline_ms)
+            {
+                close(c->fd);
+                c->fd = -1;
+                continue;
+            }
+            if (timeout < 0 || c->deadline_ms - now < (uint64_t)timeout)
+                timeout = (int)(c->deadline_ms - now);
+
+            owner[nfds] = i;
+            pfd[nfds++] = (struct pollfd){.fd = c->fd, .events = POLLIN};
+        }
+
+        if (poll(pfd, (nfds_t)nfds, timeout) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (pfd[1].revents)
+            break;
+
+        for (int k = 2; k < nfds; k++)
+        {
+            ctl_client_t *c = &clients[owner[k]];
+
+            if (pfd[k].revents && !ctl_client_read(c, reply))
+            {
+                close(c->fd);
+                c->fd = -1;
+            }
+        }
+
+        if (pfd[0].revents & POLLIN)
+            ctl_client_accept(clients);
+    }
+
+END:
+    for (int i = 0; clients && i < LOGX_CONTROL_MAX_CLIENTS; i++)
+    {
+        if (clients[i].fd >= 0)
+            close(clients[i].fd);
+    }
+    free(clients);
+    free(reply);
+    return NULL;
+}
+
+/**
+ * @brief Close the socket and wake pipe, and remove the socket file if it was bound.
+ */
+static void control_close_fds(void)
+{
+    if (g_ctl_listen_fd >= 0)
+        close(g_ctl_listen_fd);
+    /* g_ctl_path is only set once bind() succeeded, so nothing else is removed */
+    if (g_ctl_path[0])
+        unlink(g_ctl_path);
+    if (g_ctl_wake_fd[0] >= 0)
+        close(g_ctl_wake_fd[0]);
+    if (g_ctl_wake_fd[1] >= 0)
+        close(g_ctl_wake_fd[1]);
+
+    g_ctl_listen_fd  = -1;
+    g_ctl_wake_fd[0] = -1;
+    g_ctl_wake_fd[1] = -1;
+    g_ctl_path[0]    = '\0';
+}
+
+/**
+ * @brief Create the listening socket and start the control thread. Called with
+ *        `g_ctl_life` held.
+ */
+static logx_errorcodes_t control_start(const char *path)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    struct sockaddr_un addr;
+    struct stat st;
+    mode_t old_mask;
+    int rc;
+
+    /* Sanity check */
+    if (!path || !*path || strlen(path) >= sizeof(addr.sun_path))
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    if (pipe2(g_ctl_wake_fd, O_CLOEXEC) != 0)
+    {
+        eErr = LOGX_ERR_SOCKET_FAILED;
+        goto END;
+    }
+
+    g_ctl_listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (g_ctl_listen_fd < 0)
+    {
+        eErr = LOGX_ERR_SOCKET_FAILED;
+        goto END;
+    }
+
+    /* A stale socket left behind by a previous run would make bind() fail; anything
+     * else at that path is not ours to remove */
+    if (lstat(path, &st) == 0)
+    {
+        if (!S_ISSOCK(st.st_mode))
+        {
+            fprintf(stderr, "[LogX] %s exists and is not a socket\n", path);
+            eErr = LOGX_ERR_SOCKET_FAILED;
+            goto END;
+        }
+        unlink(path);
+    }
+
+    /* The socket is created 0600 rather than chmod()ed after it is reachable. The
+     * umask is process-wide, so it is only changed around bind() itself. */
+    old_mask = umask(0177);
+    rc       = bind(g_ctl_listen_fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(old_mask);
+
+    if (rc != 0)
+    {
+        eErr = LOGX_ERR_SOCKET_FAILED;
+        goto END;
+    }
+    strcpy(g_ctl_path, path);
+
+    if (listen(g_ctl_listen_fd, 4) != 0)
+    {
+        eErr = LOGX_ERR_SOCKET_FAILED;
+        goto END;
+    }
+
+    if (pthread_create(&g_ctl_thread, NULL, control_thread, NULL) != 0)
+    {
+        eErr = LOGX_ERR_THREAD_CREATION_FAILED;
+        goto END;
+    }
+    pthread_setname_np(g_ctl_thread, "logx-ctl");
+
+    g_ctl_running = 1;
+
+END:
+    if (eErr != LOGX_ERR_SUCCESS)
+        control_close_fds();
+    return eErr;
+}
+
+/**
+ * @brief Wake and join the control thread, then release its resources. Called with
+ *        `g_ctl_life` held and `g_ctl_lock` released.
+ */
+static void control_stop(void)
+{
+    static const char wake = 1;
+
+    if (!g_ctl_running)
+        return;
+
+    if (write(g_ctl_wake_fd[1], &wake, 1) < 0)
+        fprintf(stderr, "[LogX] Failed to wake the control thread: %s\n", strerror(errno));
+
+    pthread_join(g_ctl_thread, NULL);
+    control_close_fds();
+    g_ctl_running = 0;
+}
+
+logx_errorcodes_t logx_control_attach(logx_t *logger, const char *path)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger || !path)
+    {
+        eErr = LOGX_ERR_NULL_PTR;
+        goto END;
+    }
+
+    pthread_mutex_lock(&g_ctl_life);
+
+    if (!g_ctl_running && (eErr = control_start(path)) != LOGX_ERR_SUCCESS)
+        goto UNLOCK;
+
+    /* There is one socket per process; a logger asking for another one cannot be reached */
+    if (strcmp(path, g_ctl_path) != 0)
+    {
+        fprintf(stderr, "[LogX] Control socket already served on %s, not on %s\n", g_ctl_path,
+                path);
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto UNLOCK;
+    }
+
+    pthread_mutex_lock(&g_ctl_lock);
+    if (g_ctl_count < LOGX_CONTROL_MAX_LOGGERS)
+        g_ctl_loggers[g_ctl_count++] = (ctl_entry_t){.logger = logger};
+    else
+        eErr = LOGX_ERR_OUT_OF_RANGE;
+    pthread_mutex_unlock(&g_ctl_lock);
+
+    if (eErr != LOGX_ERR_SUCCESS && g_ctl_count == 0)
+        control_stop();
+
+UNLOCK:
+    pthread_mutex_unlock(&g_ctl_life);
+
+END:
+    return eErr;
+}
+
+void logx_control_detach(logx_t *logger)
+{
+    int found = 0;
+    int i;
+
+    pthread_mutex_lock(&g_ctl_life);
+
+    pthread_mutex_lock(&g_ctl_lock);
+    if ((i = ctl_find(logger)) >= 0)
+    {
+        /* No new command picks it up; wait for the ones running on it. Entries move
+         * when other loggers are detached meanwhile. */
+        g_ctl_loggers[i].detaching = 1;
+        while (g_ctl_loggers[ctl_find(logger)].pins > 0)
+            pthread_cond_wait(&g_ctl_unpinned, &g_ctl_lock);
+
+        i                = ctl_find(logger);
+        g_ctl_loggers[i] = g_ctl_loggers[--g_ctl_count];
+        found            = 1;
+    }
+    pthread_mutex_unlock(&g_ctl_lock);
+
+    if (found && g_ctl_count == 0)
+        control_stop();
+
+    pthread_mutex_unlock(&g_ctl_life);
+}
@@ -0,0 +1,57 @@
+/**
+ * @file logx_control.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Local control socket — change levels and sinks, dump stats and force rotation
+ *        on a running process.
+ *
+ * When a logger is created with `cfg.control_socket_path` set, LogX starts one
+ * background thread per process that serves a line-based protocol on a Unix
+ * domain stream socket at that path. All loggers created with that path are
+ * reachable through the same socket by name. The first path configured wins; a
+ * logger configured with another path is reported on stderr and not attached.
+ *
+ * @code
+ * $ echo 'level myapp console DEBUG' | socat - UNIX-CONNECT:/run/myapp/logx.sock
+ * OK myapp
+ * @endcode
+ *
+ * Send `help` for the list of commands.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_CONTROL_H
+#define LOGX_CONTROL_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+
+/**
+ * @brief Internal — make a logger reachable through the control socket.
+ * @internal
+ *
+ * Starts the control thread on `path` if it is not running yet.
+ *
+ * @param[in] logger Logger instance.
+ * @param[in] path   Socket path.
+ * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_SOCKET_FAILED` if the socket could not be
+ *         set up, `LOGX_ERR_THREAD_CREATION_FAILED`, or `LOGX_ERR_INVALID_ARG` if the
+ *         control thread already serves another path.
+ */
+logx_errorcodes_t logx_control_attach(logx_t *logger, const char *path);
+
+/**
+ * @brief Internal — remove a logger from the control socket.
+ * @internal
+ *
+ * Stops the control thread and removes the socket once the last logger is
+ * detached. Waits for a command in progress on this logger to finish.
+ *
+ * @param[in] logger Logger instance.
+ */
+void logx_control_detach(logx_t *logger);
+
+#endif /* LOGX_CONTROL_H */
@@ -0,0 +1,161 @@
+/**
+ * @file logx_dedup.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Repeated-message deduplication stage.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "logx_dedup.h"
+#include "logx.h"
+#include "logx_errorcodes.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+/** @brief FNV-1a 64-bit offset basis. */
+#define LOGX_FNV_OFFSET 0xcbf29ce484222325ULL
+
+/** @brief FNV-1a 64-bit prime. */
+#define LOGX_FNV_PRIME 0x100000001b3ULL
+
+/**
+ * @brief Mix a block of bytes into an FNV-1a hash.
+ *
+ * @param[in] h   Running hash.
+ * @param[in] p   Bytes to hash.
+ * @param[in] len Number of bytes.
+ * @return Updated hash.
+ */
+static uint64_t fnv1a(uint64_t h, const void *p, size_t len)
+{
+    const unsigned char *b = (const unsigned char *)p;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= b[i];
+        h *= LOGX_FNV_PRIME;
+    }
+    return h;
+}
+
+/**
+ * @brief Copy the call site of the last written record into a summary.
+ *
+ * @param[in]  d       Dedup state.
+ * @param[out] summary Summary to fill; `repeats` is taken from `d`.
+ */
+static void take_summary(logx_dedup_t *d, logx_dedup_summary_t *summary)
+{
+    summary->repeats = d->repeats;
+    summary->level   = d->level;
+    summary->flags   = d->flags;
+    summary->file    = d->file;
+    summary->func    = d->func;
+    summary->line    = d->line;
+    d->repeats       = 0;
+}
+
+/** @brief Monotonic time in nanoseconds. */
+static uint64_t dedup_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+int logx_dedup_check(logx_dedup_t *d, uint64_t window_ns, logx_level_t level, uint32_t flags,
+                     const char *file, const char *func, int line, const char *fmt,
+                     const char *payload, logx_dedup_summary_t *summary)
+{
+    uint64_t now, fp;
+
+    summary->repeats = 0;
+
+    now = dedup_now_ns();
+
+    /* Fingerprint: format pointer, call site, level, then the formatted text */
+    fp = LOGX_FNV_OFFSET;
+    fp = fnv1a(fp, &fmt, sizeof(fmt));
+    fp = fnv1a(fp, &file, sizeof(file));
+    fp = fnv1a(fp, &line, sizeof(line));
+    fp = fnv1a(fp, &level, sizeof(level));
+    fp = fnv1a(fp, payload, strlen(payload));
+
+    if (d->active && fp == d->fingerprint && now - d->last_seen_ns < window_ns)
+    {
+        d->repeats++;
+        d->last_seen_ns = now;
+
+        /* Periodic summary while the storm lasts */
+        if (now - d->last_summary_ns >= window_ns)
+        {
+            take_summary(d, summary);
+            d->last_summary_ns = now;
+        }
+        return 0;
+    }
+
+    /* A different (or expired) record — report what was collapsed before it */
+    if (d->active && d->repeats)
+        take_summary(d, summary);
+
+    d->active          = 1;
+    d->fingerprint     = fp;
+    d->last_seen_ns    = now;
+    d->last_summary_ns = now;
+    d->repeats         = 0;
+    d->level           = level;
+    d->flags           = flags;
+    d->file            = file;
+    d->func            = func;
+    d->line            = line;
+    return 1;
+}
+
+void logx_dedup_flush(logx_dedup_t *d, logx_dedup_summary_t *summary)
+{
+    summary->repeats = 0;
+    if (d->active && d->repeats)
+        take_summary(d, summary);
+}
+
+void logx_dedup_take_aged(logx_dedup_t *d, uint64_t window_ns, logx_dedup_summary_t *summary)
+{
+    uint64_t now;
+
+    summary->repeats = 0;
+    if (!d->active || !d->repeats)
+        return;
+
+    now = dedup_now_ns();
+    if (now - d->last_summary_ns < window_ns)
+        return;
+
+    take_summary(d, summary);
+    d->last_summary_ns = now;
+}
+
+logx_errorcodes_t logx_set_dedup_window_ms(logx_t *logger, int window_ms)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger || window_ms < 0)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.dedup_window_ms, window_ms, __ATOMIC_RELAXED);
+    logx_sinks_sync(logger);
+    pthread_mutex_unlock(&logger->lock);
+
+END:
+    return eErr;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file logx_dedup.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Repeated-message deduplication — collapse consecutive identical records into
+ *        one record plus a periodic "last message repeated N times" summary.
+ *
+ * A record is identified by a fingerprint of its format pointer, call site, level
+ * and a hash of the formatted payload. Consecutive records with the same
+ * fingerprint arriving within the dedup window are not written; the number of
+ * repeats is reported once per window while the storm lasts, and once more when a
+ * different record arrives, the `logx-flush` thread finds it a window old, or the
+ * logger is destroyed.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_DEDUP_H
+#define LOGX_DEDUP_H
+
+#include "logx_types.h"
+#include <stdint.h>
+
+/**
+ * @brief Per-logger dedup state embedded in `logx_t`. Protected by the logger lock.
+ */
+typedef struct
+{
+    int active;               /**< Non-zero once a record has been fingerprinted. */
+    uint64_t fingerprint;     /**< Fingerprint of the last written record. */
+    uint64_t last_seen_ns;    /**< Monotonic time the fingerprint was last seen. */
+    uint64_t last_summary_ns; /**< Monotonic time of the last summary (or first write). */
+    uint64_t repeats;         /**< Repeats collapsed since the last summary. */
+    logx_level_t level;       /**< Level of the last written record. */
+    uint32_t flags;           /**< `LOGX_FLAG_*` of the last written record. */
+    const char *file;         /**< Call-site file of the last written record. */
+    const char *func;         /**< Call-site function of the last written record. */
+    int line;                 /**< Call-site line of the last written record. */
+} logx_dedup_t;
+
+/**
+ * @brief A "last message repeated N times" record to emit.
+ * @internal
+ */
+typedef struct
+{
+    uint64_t repeats;   /**< Number of collapsed repeats; 0 = nothing to emit. */
+    logx_level_t level; /**< Level of the repeated record. */
+    uint32_t flags;     /**< `LOGX_FLAG_*` of the repeated record. */
+    const char *file;   /**< Call-site file of the repeated record. */
+    const char *func;   /**< Call-site function of the repeated record. */
+    int line;           /**< Call-site line of the repeated record. */
+} logx_dedup_summary_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Enable or disable repeated-message deduplication.
+     *
+     * @param[in] logger    Pointer to the logger instance.
+     * @param[in] window_ms Consecutive identical records arriving less than `window_ms`
+     *                      apart are collapsed, with a summary at most once per window.
+     *                      0 disables deduplication.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_set_dedup_window_ms(logx_t *logger, int window_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @brief Internal — run a formatted record through the dedup stage.
+ * @internal
+ *
+ * Must be called with the logger lock held.
+ *
+ * @param[in,out] d         Dedup state.
+ * @param[in]     window_ns Dedup window in nanoseconds.
+ * @param[in]     level     Record level.
+ * @param[in]     flags     Record `LOGX_FLAG_*` bits.
+ * @param[in]     file      Call-site file.
+ * @param[in]     func      Call-site function.
+ * @param[in]     line      Call-site line.
+ * @param[in]     fmt       Format string (fingerprinted by pointer).
+ * @param[in]     payload   Formatted message text.
+ * @param[out]    summary   Receives a summary to emit *before* this record (or instead
+ *                          of it, when the record is dropped); `repeats` is 0 if none.
+ * @return 1 if the record should be written, 0 if it was collapsed.
+ */
+int logx_dedup_check(logx_dedup_t *d, uint64_t window_ns, logx_level_t level, uint32_t flags,
+                     const char *file, const char *func, int line, const char *fmt,
+                     const char *payload, logx_dedup_summary_t *summary);
+
+/**
+ * @brief Internal — take the pending repeat count, if any, e.g. on logger destroy.
+ * @internal
+ *
+ * @param[in,out] d       Dedup state.
+ * @param[out]    summary Receives the pending summary; `repeats` is 0 if none.
+ */
+void logx_dedup_flush(logx_dedup_t *d, logx_dedup_summary_t *summary);
+
+/**
+ * @brief Internal — take the pending repeat count once a window has passed since the
+ *        last summary.
+ * @internal
+ *
+ * Must be called with the logger lock held.
+ *
+ * @param[in,out] d         Dedup state.
+ * @param[in]     window_ns Dedup window in nanoseconds.
+ * @param[out]    summary   Receives the pending summary; `repeats` is 0 if none is due.
+ */
+void logx_dedup_take_aged(logx_dedup_t *d, uint64_t window_ns, logx_dedup_summary_t *summary);
+
+/**
+ * @brief Internal — write the summary a logger that went quiet still owes (`logx.c`).
+ * @internal
+ *
+ * Called by the `logx-flush` thread on every tick. A tick that finds the logger
+ * lock taken is skipped; the next one catches up.
+ *
+ * @param[in,out] logger Logger instance.
+ */
+void logx_dedup_write_aged(logx_t *logger);
+
+#endif /* LOGX_DEDUP_H */
@@ -0,0 +1,356 @@
+/**
+ * @file logx_direct.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief O_DIRECT file writer — aligned buffer swapping, flusher thread and exact-size
+ *        tail handling.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* O_DIRECT, pthread_setname_np */
+
+#include "logx_direct.h"
+#include "logx.h"
+#include "logx_common.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if LOGX_DIRECT_BUFFER_SIZE % LOGX_DIRECT_ALIGN != 0
+#error "LOGX_DIRECT_BUFFER_SIZE must be a multiple of LOGX_DIRECT_ALIGN"
+#endif
+
+#if LOGX_DIRECT_BUFFER_COUNT < 2
+#error "LOGX_DIRECT_BUFFER_COUNT must be at least 2"
+#endif
+
+/**
+ * @brief Life cycle of one buffer.
+ */
+typedef enum
+{
+    DIRECT_BUF_FREE = 0, /**< Available to the logging thread. */
+    DIRECT_BUF_FILLING,  /**< Being filled by the logging thread. */
+    DIRECT_BUF_QUEUED    /**< Full; waiting for or being written by the flusher. */
+} direct_buf_state_t;
+
+/**
+ * @brief Writer state. Buffers are filled and written in ring order.
+ */
+struct logx_direct_t
+{
+    int fd;                                             /**< File opened with `O_DIRECT`. */
+    char *bufs;                                         /**< All buffers, aligned. */
+    size_t fill[LOGX_DIRECT_BUFFER_COUNT];              /**< Bytes used per buffer. */
+    off_t base[LOGX_DIRECT_BUFFER_COUNT];               /**< File offset per buffer (aligned). */
+    direct_buf_state_t state[LOGX_DIRECT_BUFFER_COUNT]; /**< State per buffer. */
+    unsigned cur;                                       /**< Buffer being filled. */
+    unsigned next_flush;                                /**< Oldest buffer the flusher owes. */
+    off_t size;                                         /**< Logical size of the file. */
+    logx_errorcodes_t err;                              /**< Write error not yet reported. */
+    int stop;                                           /**< Ask the flusher to exit. */
+    pthread_t thread;                                   /**< Flusher thread. */
+    pthread_mutex_t lock;                               /**< Guards the buffer states. */
+    pthread_cond_t cond;                                /**< Signalled on every state change. */
+};
+
+/** @brief Start of buffer `i`. */
+static char *direct_buf(logx_direct_t *d, unsigned i)
+{
+    return d->bufs + (size_t)i * LOGX_DIRECT_BUFFER_SIZE;
+}
+
+/**
+ * @brief pwrite(2) all of `len` bytes; every argument must be `O_DIRECT` aligned.
+ * @return 0 on success, otherwise an errno value.
+ */
+static int direct_pwrite_all(int fd, const char *src, size_t len, off_t off)
+{
+    while (len > 0)
+    {
+        ssize_t n = pwrite(fd, src, len, off);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return n < 0 ? errno : EIO;
+        src += n;
+        off += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief Write the current buffer padded to a whole block, then trim the padding.
+ *
+ * Called with `d->lock` held while the flusher is idle. With `probe` set, a block
+ * is written even if the buffer is empty, to find out whether writes work at all.
+ *
+ * @return 0 on success, otherwise an errno value.
+ */
+static int direct_write_tail(logx_direct_t *d, int probe)
+{
+    char *buf  = direct_buf(d, d->cur);
+    size_t len = (d->fill[d->cur] + LOGX_DIRECT_ALIGN - 1) / LOGX_DIRECT_ALIGN * LOGX_DIRECT_ALIGN;
+    int rc     = 0;
+
+    if (len == 0 && probe)
+        len = LOGX_DIRECT_ALIGN;
+    memset(buf + d->fill[d->cur], 0, len - d->fill[d->cur]);
+
+    if (len > 0)
+        rc = direct_pwrite_all(d->fd, buf, len, d->base[d->cur]);
+    if (rc == 0 && ftruncate(d->fd, d->size) != 0)
+        rc = errno;
+    return rc;
+}
+
+/**
+ * @brief Flusher thread: write queued buffers in order until asked to stop.
+ */
+static void *direct_thread(void *arg)
+{
+    logx_direct_t *d = arg;
+
+    pthread_mutex_lock(&d->lock);
+    for (;;)
+    {
+        unsigned i = d->next_flush;
+
+        while (!d->stop && d->state[i] != DIRECT_BUF_QUEUED)
+            pthread_cond_wait(&d->cond, &d->lock);
+        if (d->state[i] != DIRECT_BUF_QUEUED)
+            break;
+
+        /* The buffer is not touched by the logging thread until it is FREE again */
+        pthread_mutex_unlock(&d->lock);
+        int rc = direct_pwrite_all(d->fd, direct_buf(d, i), LOGX_DIRECT_BUFFER_SIZE, d->base[i]);
+        pthread_mutex_lock(&d->lock);
+
+        if (rc != 0 && d->err == LOGX_ERR_SUCCESS)
+            d->err = LOGX_ERR_FILE_WRITE_FAILED;
+        d->state[i]   = DIRECT_BUF_FREE;
+        d->fill[i]    = 0;
+        d->next_flush = (i + 1) % LOGX_DIRECT_BUFFER_COUNT;
+        pthread_cond_broadcast(&d->cond);
+    }
+    pthread_mutex_unlock(&d->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Release a writer whose flusher is not running.
+ */
+static void direct_free(logx_direct_t *d)
+{
+    if (!d)
+        return;
+    if (d->fd >= 0)
+        close(d->fd);
+    pthread_cond_destroy(&d->cond);
+    pthread_mutex_destroy(&d->lock);
+    free(d->bufs);
+    free(d);
+}
+
+/**
+ * @brief Open `path` for direct I/O and load its unaligned last block.
+ * @return 0 on success, otherwise an errno value.
+ */
+static int direct_open(const char *path, logx_direct_t **out)
+{
+    logx_direct_t *d = NULL;
+    int rc           = 0;
+
+    d = calloc(1, sizeof(*d));
+    if (!d)
+        return ENOMEM;
+    d->fd = -1;
+    pthread_mutex_init(&d->lock, NULL);
+    pthread_cond_init(&d->cond, NULL);
+
+    if (posix_memalign((void **)&d->bufs, LOGX_DIRECT_ALIGN,
+                       (size_t)LOGX_DIRECT_BUFFER_COUNT * LOGX_DIRECT_BUFFER_SIZE) != 0)
+    {
+        rc = ENOMEM;
+        goto END;
+    }
+
+    d->fd = open(path, O_RDWR | O_CREAT | O_DIRECT | O_CLOEXEC, 0644);
+    if (d->fd < 0)
+    {
+        rc = errno;
+        goto END;
+    }
+
+    d->size = lseek(d->fd, 0, SEEK_END);
+    if (d->size < 0)
+    {
+        rc = errno;
+        goto END;
+    }
+
+    /* Appending starts at the block holding the end of the file; it is rewritten whole */
+    d->cur      = 0;
+    d->base[0]  = d->size - d->size % LOGX_DIRECT_ALIGN;
+    d->fill[0]  = (size_t)(d->size - d->base[0]);
+    d->state[0] = DIRECT_BUF_FILLING;
+    if (d->fill[0] > 0)
+    {
+        ssize_t n = pread(d->fd, direct_buf(d, 0), LOGX_DIRECT_ALIGN, d->base[0]);
+        if (n != (ssize_t)d->fill[0])
+        {
+            rc = n < 0 ? errno : EIO;
+            goto END;
+        }
+    }
+
+    /* Some file systems accept O_DIRECT at open() and only reject the writes */
+    if ((rc = direct_write_tail(d, 1)) != 0)
+        goto END;
+
+    if (pthread_create(&d->thread, NULL, direct_thread, d) != 0)
+    {
+        rc = EAGAIN;
+        goto END;
+    }
+    pthread_setname_np(d->thread, "logx-direct");
+
+    *out = d;
+    d    = NULL;
+
+END:
+    direct_free(d);
+    return rc;
+}
+
+logx_errorcodes_t logx_direct_write(logx_direct_t *d, const char *src, size_t len)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_lock(&d->lock);
+
+    while (len > 0)
+    {
+        unsigned i  = d->cur;
+        size_t room = LOGX_DIRECT_BUFFER_SIZE - d->fill[i];
+        size_t n    = len < room ? len : room;
+
+        memcpy(direct_buf(d, i) + d->fill[i], src, n);
+        d->fill[i] += n;
+        d->size += (off_t)n;
+        src += n;
+        len -= n;
+
+        if (d->fill[i] < LOGX_DIRECT_BUFFER_SIZE)
+            continue;
+
+        /* Hand the full buffer to the flusher and move on to the next one */
+        unsigned next = (i + 1) % LOGX_DIRECT_BUFFER_COUNT;
+        d->state[i]   = DIRECT_BUF_QUEUED;
+        pthread_cond_broadcast(&d->cond);
+        while (d->state[next] != DIRECT_BUF_FREE)
+            pthread_cond_wait(&d->cond, &d->lock);
+
+        d->state[next] = DIRECT_BUF_FILLING;
+        d->fill[next]  = 0;
+        d->base[next]  = d->base[i] + LOGX_DIRECT_BUFFER_SIZE;
+        d->cur         = next;
+    }
+
+    eErr   = d->err;
+    d->err = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_unlock(&d->lock);
+    return eErr;
+}
+
+logx_errorcodes_t logx_direct_sync(logx_direct_t *d)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_lock(&d->lock);
+
+    /* Let the flusher finish every full buffer before the tail is written behind them */
+    for (unsigned i = 0; i < LOGX_DIRECT_BUFFER_COUNT; i++)
+    {
+        while (d->state[i] == DIRECT_BUF_QUEUED)
+            pthread_cond_wait(&d->cond, &d->lock);
+    }
+
+    /* The current buffer keeps its content and offset, so the partial block is
+     * simply written again, completed, once the buffer fills up */
+    if (direct_write_tail(d, 0) != 0)
+        eErr = LOGX_ERR_FILE_WRITE_FAILED;
+    if (d->err != LOGX_ERR_SUCCESS)
+        eErr = d->err;
+    d->err = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_unlock(&d->lock);
+    return eErr;
+}
+
+off_t logx_direct_size(logx_direct_t *d)
+{
+    off_t size;
+
+    pthread_mutex_lock(&d->lock);
+    size = d->size;
+    pthread_mutex_unlock(&d->lock);
+
+    return size;
+}
+
+logx_direct_t *logx_direct_open(const char *path)
+{
+    logx_direct_t *d = NULL;
+    int rc           = direct_open(path, &d);
+
+    if (rc != 0)
+        fprintf(stderr, "[LogX] O_DIRECT unavailable for %s (%s), using buffered writes\n", path,
+                strerror(rc));
+    return d;
+}
+
+void logx_direct_close(logx_direct_t *d)
+{
+    if (!d)
+        return;
+
+    if (logx_direct_sync(d) != LOGX_ERR_SUCCESS)
+        fprintf(stderr, "[LogX] Failed to write the end of the O_DIRECT log file\n");
+
+    pthread_mutex_lock(&d->lock);
+    d->stop = 1;
+    pthread_cond_broadcast(&d->cond);
+    pthread_mutex_unlock(&d->lock);
+    pthread_join(d->thread, NULL);
+
+    direct_free(d);
+}
+
+void logx_direct_start(logx_t *logger)
+{
+    if (logger->direct || logger->shm || !logger->cfg.file_direct_io ||
+        !logger->cfg.enable_file_logging || !logger->cfg.file_path)
+        return;
+
+    /* Anything stdio still holds must land before the first direct write */
+    if (logger->fp)
+        fflush(logger->fp);
+
+    logger->direct = logx_direct_open(logger->cfg.file_path);
+}
+
+void logx_direct_stop(logx_t *logger)
+{
+    logx_direct_close(logger->direct);
+    logger->direct = NULL;
+}
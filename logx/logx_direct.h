@@ -0,0 +1,126 @@
+/**
+ * @file logx_direct.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief O_DIRECT file writer — the built-in file sink's page-cache bypassing mode.
+ *
+ * With `file_direct_io` enabled, the file sink stops writing through stdio and
+ * hands records to this writer instead. The log file is opened with `O_DIRECT`
+ * and records are copied into `LOGX_DIRECT_BUFFER_COUNT` aligned buffers of
+ * `LOGX_DIRECT_BUFFER_SIZE` bytes. The logging thread fills one buffer while a
+ * flusher thread (`logx-direct`) writes the full ones, so at high volume the
+ * logging thread only waits when every buffer is still queued.
+ *
+ * Only whole buffers at aligned offsets are written while logging. The partly
+ * filled last block is written on `logx_flush()`, rotation, reload and
+ * `logx_destroy()`: it is padded to `LOGX_DIRECT_ALIGN` and the file is then
+ * truncated to its exact length, so the file on disk is always byte-exact after
+ * one of these. Records still in a buffer are lost if the process crashes.
+ *
+ * If the file system refuses `O_DIRECT` (tmpfs, some network file systems), the
+ * logger says so on stderr and keeps writing through stdio. Direct mode assumes
+ * this process is the only writer of the file.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_DIRECT_H
+#define LOGX_DIRECT_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+#include <stddef.h>
+#include <sys/types.h>
+
+/** @brief Alignment of buffers, offsets and lengths for `O_DIRECT` I/O in bytes. */
+#ifndef LOGX_DIRECT_ALIGN
+#define LOGX_DIRECT_ALIGN 4096
+#endif
+
+/** @brief Size of one direct-I/O buffer in bytes; a multiple of `LOGX_DIRECT_ALIGN`. */
+#ifndef LOGX_DIRECT_BUFFER_SIZE
+#define LOGX_DIRECT_BUFFER_SIZE (1024 * 1024)
+#endif
+
+/** @brief Number of direct-I/O buffers swapped between the logger and the flusher (>= 2). */
+#ifndef LOGX_DIRECT_BUFFER_COUNT
+#define LOGX_DIRECT_BUFFER_COUNT 2
+#endif
+
+/** @brief Opaque O_DIRECT writer state owned by a logger. */
+typedef struct logx_direct_t logx_direct_t;
+
+/**
+ * @brief Internal — open a file for direct I/O, appending at its current end.
+ * @internal
+ *
+ * Nothing else may write the file while the writer is open. On failure the reason
+ * is printed and NULL returned, and the caller keeps using stdio.
+ *
+ * @param[in] path Log file path.
+ * @return The writer, or NULL.
+ */
+logx_direct_t *logx_direct_open(const char *path);
+
+/**
+ * @brief Internal — write out everything, trim the file to its exact size and close
+ *        a writer.
+ * @internal
+ * @param[in] d Writer, or NULL.
+ */
+void logx_direct_close(logx_direct_t *d);
+
+/**
+ * @brief Internal — open `cfg.file_path` for direct I/O if `file_direct_io` is set.
+ * @internal
+ *
+ * Does nothing if the writer is already open or direct mode is off. On failure
+ * the reason is printed and the file sink keeps using stdio. Must be called with
+ * the file sink lock held, or with no record in flight.
+ *
+ * @param[in,out] logger Logger instance.
+ */
+void logx_direct_start(logx_t *logger);
+
+/**
+ * @brief Internal — write out everything, trim the file to its exact size and close
+ *        the direct writer, if one is open.
+ * @internal
+ *
+ * Must be called with the file sink lock held, or with no record in flight.
+ *
+ * @param[in,out] logger Logger instance.
+ */
+void logx_direct_stop(logx_t *logger);
+
+/**
+ * @brief Internal — append bytes to the file through the direct writer.
+ * @internal
+ * @param[in,out] d   Writer.
+ * @param[in]     src Bytes to append.
+ * @param[in]     len Number of bytes.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_FILE_WRITE_FAILED` if a write failed
+ *         since the last call.
+ */
+logx_errorcodes_t logx_direct_write(logx_direct_t *d, const char *src, size_t len);
+
+/**
+ * @brief Internal — write everything buffered, including the unaligned tail, and trim
+ *        the file to its exact size.
+ * @internal
+ * @param[in,out] d Writer.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_FILE_WRITE_FAILED`.
+ */
+logx_errorcodes_t logx_direct_sync(logx_direct_t *d);
+
+/**
+ * @brief Internal — logical size of the file, buffered bytes included.
+ * @internal
+ * @param[in] d Writer.
+ * @return Size in bytes.
+ */
+off_t logx_direct_size(logx_direct_t *d);
+
+#endif /* LOGX_DIRECT_H */
@@ -0,0 +1,690 @@
+/**
+ * @file logx_format.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Pre-parsed format strings and their specialized formatter.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "logx_format.h"
+#include <float.h>
+#include <limits.h>
+#include <locale.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+/** @name Flag bits of `logx_format_spec_t::flags` */
+/** @{ */
+#define FORMAT_MINUS (1U << 0) /**< `-`: left-justify. */
+#define FORMAT_PLUS  (1U << 1) /**< `+`: always a sign. */
+#define FORMAT_SPACE (1U << 2) /**< ` `: space for a positive sign. */
+#define FORMAT_ALT   (1U << 3) /**< `#`: alternate form. */
+#define FORMAT_ZERO  (1U << 4) /**< `0`: pad with zeros. */
+/** @} */
+
+/**
+ * @brief Length modifiers of `logx_format_spec_t::length`.
+ */
+enum
+{
+    FORMAT_LEN_NONE = 0, /**< `int` / `unsigned int` / `double`. */
+    FORMAT_LEN_HH,       /**< `hh`: `char`. */
+    FORMAT_LEN_H,        /**< `h`: `short`. */
+    FORMAT_LEN_L,        /**< `l`: `long`. */
+    FORMAT_LEN_LL,       /**< `ll`: `long long`. */
+    FORMAT_LEN_Z,        /**< `z`: `size_t`. */
+    FORMAT_LEN_J,        /**< `j`: `intmax_t`. */
+    FORMAT_LEN_T         /**< `t`: `ptrdiff_t`. */
+};
+
+/** @brief Largest `%f` precision run by the fast path (`10^17 * 2^53` fits in 128 bits). */
+#define FORMAT_FLOAT_PREC_MAX 17
+
+/** @brief Largest binary exponent of an integral `%f` value the fast path runs. */
+#define FORMAT_FLOAT_EXP_MAX 17
+
+/** @brief Site format slot value for a format left to `vsnprintf()`. */
+static const logx_format_t g_format_none;
+
+/**
+ * @brief Output of the formatter; counts everything, stores what fits.
+ */
+typedef struct
+{
+    char *buf;   /**< Destination. */
+    size_t size; /**< Size of `buf`. */
+    size_t len;  /**< Length of the full output so far. */
+} format_out_t;
+
+/** @brief Append `n` bytes of `s`. */
+static void format_put(format_out_t *o, const char *s, size_t n)
+{
+    if (o->len < o->size)
+    {
+        size_t room = o->size - o->len;
+        memcpy(o->buf + o->len, s, n < room ? n : room);
+    }
+    o->len += n;
+}
+
+/** @brief Append `n` copies of `c`. */
+static void format_pad(format_out_t *o, char c, size_t n)
+{
+    if (o->len < o->size)
+    {
+        size_t room = o->size - o->len;
+        memset(o->buf + o->len, c, n < room ? n : room);
+    }
+    o->len += n;
+}
+
+/**
+ * @brief Append one field: `sign` (may be empty), zeros, `body` and the width padding.
+ *
+ * @param[in,out] o     Output.
+ * @param[in]     sp    Spec of the field.
+ * @param[in]     sign  Sign and prefix (`-`, `0x`, ...).
+ * @param[in]     slen  Length of `sign`.
+ * @param[in]     zeros Zeros between sign and body (precision of an integer).
+ * @param[in]     body  Digits or text.
+ * @param[in]     blen  Length of `body`.
+ * @param[in]     zpad  1 if the `0` flag pads this field with zeros.
+ */
+static void format_field(format_out_t *o, const logx_format_spec_t *sp, const char *sign,
+                         size_t slen, size_t zeros, const char *body, size_t blen, int zpad)
+{
+    size_t total = slen + zeros + blen;
+    size_t pad   = (size_t)sp->width > total ? (size_t)sp->width - total : 0;
+
+    if (pad && !(sp->flags & FORMAT_MINUS) && !zpad)
+        format_pad(o, ' ', pad);
+    format_put(o, sign, slen);
+    if (pad && !(sp->flags & FORMAT_MINUS) && zpad)
+        format_pad(o, '0', pad);
+    format_pad(o, '0', zeros);
+    format_put(o, body, blen);
+    if (pad && (sp->flags & FORMAT_MINUS))
+        format_pad(o, ' ', pad);
+}
+
+/**
+ * @brief Write `v` in `base` right-aligned, ending at `end`.
+ * @return First digit.
+ */
+static char *format_digits(char *end, uintmax_t v, unsigned int base, int upper)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char *p            = end;
+
+    if (base == 10)
+    {
+        /* 32-bit division is cheaper; most logged values fit */
+        while (v > UINT32_MAX)
+        {
+            *--p = (char)('0' + v % 10);
+            v /= 10;
+        }
+        uint32_t w = (uint32_t)v;
+        do
+        {
+            *--p = (char)('0' + w % 10);
+            w /= 10;
+        } while (w);
+        return p;
+    }
+
+    do
+    {
+        *--p = digits[v % base];
+        v /= base;
+    } while (v);
+    return p;
+}
+
+/**
+ * @brief Format one value the fast paths leave out with `snprintf()` and the spec as written.
+ *
+ * @param[in,out] o   Output.
+ * @param[in]     sp  Spec of the value.
+ * @param[in]     ptr Value of a `%s` or `%p` conversion.
+ * @param[in]     d   Value of a `%f` conversion.
+ */
+static void format_fallback(format_out_t *o, const logx_format_spec_t *sp, const void *ptr,
+                            double d)
+{
+    char spec[LOGX_FORMAT_SPEC_MAX + 1];
+    char tmp[512];
+    char *out = tmp;
+    int n     = 0;
+
+    memcpy(spec, sp->spec, sp->spec_len);
+    spec[sp->spec_len] = '\0';
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        size_t size = pass ? (size_t)n + 1 : sizeof(tmp);
+
+        if (sp->conv == 's')
+            n = snprintf(out, size, spec, (const char *)ptr);
+        else if (sp->conv == 'p')
+            n = snprintf(out, size, spec, ptr);
+        else
+            n = snprintf(out, size, spec, d);
+
+        if (n < 0 || pass || (size_t)n < sizeof(tmp))
+            break;
+
+        /* Wider than the stack buffer (a huge %f or width) */
+        out = malloc((size_t)n + 1);
+        if (!out)
+        {
+            format_pad(o, ' ', (size_t)n);
+            return;
+        }
+    }
+
+    if (n > 0)
+        format_put(o, out, (size_t)n);
+    if (out != tmp)
+        free(out);
+}
+
+/**
+ * @brief Format an integer conversion (`d`, `i`, `u`, `x`, `X`, `o`).
+ */
+static void format_int(format_out_t *o, const logx_format_spec_t *sp, va_list *ap)
+{
+    int is_signed = sp->conv == 'd' || sp->conv == 'i';
+    int neg       = 0;
+    uintmax_t v   = 0;
+    char sign[2];
+    size_t slen = 0;
+    char buf[24];
+    char *end = buf + sizeof(buf);
+
+    if (is_signed)
+    {
+        intmax_t s = 0;
+
+        switch (sp->length)
+        {
+            case FORMAT_LEN_HH:
+                s = (signed char)va_arg(*ap, int);
+                break;
+            case FORMAT_LEN_H:
+                s = (short)va_arg(*ap, int);
+                break;
+            case FORMAT_LEN_L:
+                s = va_arg(*ap, long);
+                break;
+            case FORMAT_LEN_LL:
+                s = va_arg(*ap, long long);
+                break;
+            case FORMAT_LEN_Z:
+                s = va_arg(*ap, ssize_t);
+                break;
+            case FORMAT_LEN_J:
+                s = va_arg(*ap, intmax_t);
+                break;
+            case FORMAT_LEN_T:
+                s = va_arg(*ap, ptrdiff_t);
+                break;
+            default:
+                s = va_arg(*ap, int);
+                break;
+        }
+        neg = s < 0;
+        v   = neg ? 0U - (uintmax_t)s : (uintmax_t)s;
+    }
+    else
+    {
+        switch (sp->length)
+        {
+            case FORMAT_LEN_HH:
+                v = (unsigned char)va_arg(*ap, unsigned int);
+                break;
+            case FORMAT_LEN_H:
+                v = (unsigned short)va_arg(*ap, unsigned int);
+                break;
+            case FORMAT_LEN_L:
+                v = va_arg(*ap, unsigned long);
+                break;
+            case FORMAT_LEN_LL:
+                v = va_arg(*ap, unsigned long long);
+                break;
+            case FORMAT_LEN_Z:
+                v = va_arg(*ap, size_t);
+                break;
+            case FORMAT_LEN_J:
+                v = va_arg(*ap, uintmax_t);
+                break;
+            case FORMAT_LEN_T:
+                v = (size_t)va_arg(*ap, ptrdiff_t);
+                break;
+            default:
+                v = va_arg(*ap, unsigned int);
+                break;
+        }
+    }
+
+    unsigned int base = sp->conv == 'o' ? 8 : (sp->conv == 'x' || sp->conv == 'X') ? 16 : 10;
+    char *p           = end;
+
+    /* A zero precision prints nothing for a zero value */
+    if (v != 0 || sp->prec != 0)
+        p = format_digits(end, v, base, sp->conv == 'X');
+
+    size_t ndig  = (size_t)(end - p);
+    size_t prec  = sp->prec < 0 ? 1 : (size_t)sp->prec;
+    size_t zeros = prec > ndig ? prec - ndig : 0;
+
+    if (neg)
+        sign[slen++] = '-';
+    else if (is_signed && (sp->flags & FORMAT_PLUS))
+        sign[slen++] = '+';
+    else if (is_signed && (sp->flags & FORMAT_SPACE))
+        sign[slen++] = ' ';
+
+    if (sp->flags & FORMAT_ALT)
+    {
+        /* "#o" makes the first digit a 0, "#x" prefixes a non-zero value with 0x */
+        if (sp->conv == 'o' && zeros == 0 && (ndig == 0 || *p != '0'))
+            zeros = 1;
+        else if (base == 16 && v != 0)
+        {
+            sign[slen++] = '0';
+            sign[slen++] = sp->conv;
+        }
+    }
+
+    format_field(o, sp, sign, slen, zeros, p, ndig,
+                 (sp->flags & FORMAT_ZERO) && sp->prec < 0);
+}
+
+/**
+ * @brief Format a `%f` / `%F` value exactly, as the C library rounds it in the
+ *        to-nearest mode.
+ *
+ * @return 1 if formatted, 0 if the value is left to `snprintf()`.
+ */
+static int format_float(format_out_t *o, const logx_format_spec_t *sp, double d,
+                        const char *point)
+{
+    static const uint64_t pow10[FORMAT_FLOAT_PREC_MAX + 1] = {1ULL,
+                                                              10ULL,
+                                                              100ULL,
+                                                              1000ULL,
+                                                              10000ULL,
+                                                              100000ULL,
+                                                              1000000ULL,
+                                                              10000000ULL,
+                                                              100000000ULL,
+                                                              1000000000ULL,
+                                                              10000000000ULL,
+                                                              100000000000ULL,
+                                                              1000000000000ULL,
+                                                              10000000000000ULL,
+                                                              100000000000000ULL,
+                                                              1000000000000000ULL,
+                                                              10000000000000000ULL,
+                                                              100000000000000000ULL};
+    unsigned int prec = sp->prec < 0 ? 6U : (unsigned int)sp->prec;
+    uint64_t bits     = 0;
+    char sign[1];
+    size_t slen = 0;
+    char buf[64];
+    char *end = buf + sizeof(buf);
+    char *p   = end;
+
+    if (prec > FORMAT_FLOAT_PREC_MAX || point[0] != '.' || point[1] != '\0' || FLT_ROUNDS != 1)
+        return 0;
+
+    memcpy(&bits, &d, sizeof(bits));
+
+    int biased    = (int)((bits >> 52) & 0x7FF);
+    uint64_t mant = bits & ((1ULL << 52) - 1);
+    int exp       = biased ? biased - 1075 : -1074;
+
+    if (biased == 0x7FF || exp > FORMAT_FLOAT_EXP_MAX)
+        return 0;
+    if (biased)
+        mant |= 1ULL << 52;
+
+    /* q = round(|d| * 10^prec), ties to even, on the exact binary value */
+    unsigned __int128 q = (unsigned __int128)mant * pow10[prec];
+
+    if (exp >= 0)
+        q <<= exp;
+    else if (-exp >= 128)
+        q = 0;
+    else
+    {
+        int shift              = -exp;
+        unsigned __int128 half = (unsigned __int128)1 << (shift - 1);
+        unsigned __int128 rem  = q & ((half << 1) - 1);
+
+        q >>= shift;
+        if (rem > half || (rem == half && (q & 1)))
+            q++;
+    }
+
+    /* Fraction digits, then the point, then the integral part */
+    unsigned __int128 ipart = q / pow10[prec];
+    uint64_t frac           = (uint64_t)(q % pow10[prec]);
+
+    for (unsigned int i = 0; i < prec; i++)
+    {
+        *--p = (char)('0' + frac % 10);
+        frac /= 10;
+    }
+    if (prec || (sp->flags & FORMAT_ALT))
+        *--p = '.';
+    while (ipart > UINT64_MAX)
+    {
+        *--p = (char)('0' + (int)(ipart % 10));
+        ipart /= 10;
+    }
+    p = format_digits(p, (uint64_t)ipart, 10, 0);
+
+    if (bits >> 63)
+        sign[slen++] = '-';
+    else if (sp->flags & FORMAT_PLUS)
+        sign[slen++] = '+';
+    else if (sp->flags & FORMAT_SPACE)
+        sign[slen++] = ' ';
+
+    format_field(o, sp, sign, slen, 0, p, (size_t)(end - p), (sp->flags & FORMAT_ZERO) != 0);
+    return 1;
+}
+
+/**
+ * @brief Parse one conversion spec, starting after its `%`.
+ *
+ * @param[in]  s  Text after the `%`.
+ * @param[out] sp Spec (conversion, flags, width, precision, length).
+ * @return Length of the spec after the `%`, or 0 if the formatter does not handle it.
+ */
+static size_t format_parse_spec(const char *s, logx_format_spec_t *sp)
+{
+    const char *p = s;
+
+    for (;; p++)
+    {
+        if (*p == '-')
+            sp->flags |= FORMAT_MINUS;
+        else if (*p == '+')
+            sp->flags |= FORMAT_PLUS;
+        else if (*p == ' ')
+            sp->flags |= FORMAT_SPACE;
+        else if (*p == '#')
+            sp->flags |= FORMAT_ALT;
+        else if (*p == '0')
+            sp->flags |= FORMAT_ZERO;
+        else
+            break;
+    }
+
+    /* Literal width and precision only; '*' and "n$" are left to vsnprintf() */
+    while (*p >= '0' && *p <= '9')
+    {
+        if (sp->width > 9999)
+            return 0;
+        sp->width = sp->width * 10 + (*p++ - '0');
+    }
+    if (*p == '$')
+        return 0;
+    sp->prec = -1;
+    if (*p == '.')
+    {
+        p++;
+        sp->prec = 0;
+        while (*p >= '0' && *p <= '9')
+        {
+            if (sp->prec > 9999)
+                return 0;
+            sp->prec = sp->prec * 10 + (*p++ - '0');
+        }
+    }
+
+    switch (*p)
+    {
+        case 'h':
+            sp->length = p[1] == 'h' ? FORMAT_LEN_HH : FORMAT_LEN_H;
+            p += p[1] == 'h' ? 2 : 1;
+            break;
+        case 'l':
+            sp->length = p[1] == 'l' ? FORMAT_LEN_LL : FORMAT_LEN_L;
+            p += p[1] == 'l' ? 2 : 1;
+            break;
+        case 'z':
+            sp->length = FORMAT_LEN_Z;
+            p++;
+            break;
+        case 'j':
+            sp->length = FORMAT_LEN_J;
+            p++;
+            break;
+        case 't':
+            sp->length = FORMAT_LEN_T;
+            p++;
+            break;
+        default:
+            break;
+    }
+
+    sp->conv = *p;
+    switch (*p)
+    {
+        case 'd':
+        case 'i':
+            if (sp->flags & FORMAT_ALT)
+                return 0;
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            if ((sp->flags & (FORMAT_PLUS | FORMAT_SPACE)) ||
+                (sp->conv == 'u' && (sp->flags & FORMAT_ALT)))
+                return 0;
+            break;
+        case 'f':
+        case 'F':
+            if (sp->length != FORMAT_LEN_NONE && sp->length != FORMAT_LEN_L)
+                return 0;
+            break;
+        case 's':
+            if (sp->length != FORMAT_LEN_NONE || (sp->flags & ~FORMAT_MINUS))
+                return 0;
+            break;
+        case 'c':
+        case 'p':
+            if (sp->length != FORMAT_LEN_NONE || (sp->flags & ~FORMAT_MINUS) || sp->prec >= 0)
+                return 0;
+            break;
+        default:
+            return 0;
+    }
+
+    size_t len = (size_t)(p + 1 - s);
+    return len + 1 <= LOGX_FORMAT_SPEC_MAX ? len : 0;
+}
+
+logx_errorcodes_t logx_format_compile(const char *fmt, logx_format_t **out)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_format_t *f       = NULL;
+    size_t room            = 1;
+    const char *p          = fmt;
+
+    *out = NULL;
+
+    /* Every spec ends at a '%' or at the end of the format */
+    for (const char *s = fmt; *s; s++)
+        room += *s == '%';
+
+    f = calloc(1, sizeof(*f) + room * sizeof(f->specs[0]));
+    if (!f)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+    f->fmt = fmt;
+
+    while (*p)
+    {
+        logx_format_spec_t *sp = &f->specs[f->count++];
+        const char *start      = p;
+
+        while (*p && *p != '%')
+            p++;
+        sp->text = start;
+        sp->len  = (size_t)(p - start);
+
+        if (!*p)
+            break;
+
+        /* "%%" ends the chunk with its first '%' */
+        if (p[1] == '%')
+        {
+            sp->len++;
+            p += 2;
+            continue;
+        }
+
+        size_t n = format_parse_spec(p + 1, sp);
+        if (!n)
+        {
+            free(f);
+            f = NULL;
+            goto END;
+        }
+        sp->spec     = p;
+        sp->spec_len = (uint8_t)(n + 1);
+        p += n + 1;
+    }
+
+    *out = f;
+
+END:
+    return eErr;
+}
+
+const logx_format_t *logx_format_site(logx_callsite_t *site, const char *fmt)
+{
+    const logx_format_t *f = __atomic_load_n(&site->fmt, __ATOMIC_ACQUIRE);
+
+    if (!f)
+    {
+        logx_format_t *mine = NULL;
+
+        /* Out of memory: no slot value, so a later record tries again */
+        if (logx_format_compile(fmt, &mine) != LOGX_ERR_SUCCESS)
+            return NULL;
+
+        const logx_format_t *want = mine ? mine : &g_format_none;
+
+        /* Threads racing on the first record: one parsed format wins */
+        if (__atomic_compare_exchange_n(&site->fmt, &f, want, 0, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE))
+            f = want;
+        else
+            free(mine);
+    }
+
+    return (f == &g_format_none || f->fmt != fmt) ? NULL : f;
+}
+
+int logx_format_vsnprintf(const logx_format_t *f, char *buf, size_t size, va_list ap)
+{
+    format_out_t o    = {buf, size, 0};
+    const char *point = NULL;
+    va_list args;
+
+    va_copy(args, ap);
+
+    for (size_t i = 0; i < f->count; i++)
+    {
+        const logx_format_spec_t *sp = &f->specs[i];
+
+        format_put(&o, sp->text, sp->len);
+
+        switch (sp->conv)
+        {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                format_int(&o, sp, &args);
+                break;
+
+            case 'c':
+            {
+                char c = (char)(unsigned char)va_arg(args, int);
+                format_field(&o, sp, "", 0, 0, &c, 1, 0);
+                break;
+            }
+
+            case 's':
+            {
+                const char *s = va_arg(args, const char *);
+
+                if (!s)
+                    format_fallback(&o, sp, s, 0.0);
+                else
+                    format_field(&o, sp, "", 0, 0, s,
+                                 sp->prec < 0 ? strlen(s) : strnlen(s, (size_t)sp->prec), 0);
+                break;
+            }
+
+            case 'p':
+            {
+                const void *ptr = va_arg(args, const void *);
+                char pbuf[2 + sizeof(uintptr_t) * 2];
+                char *end = pbuf + sizeof(pbuf);
+                char *d   = NULL;
+
+                if (!ptr)
+                {
+                    format_fallback(&o, sp, ptr, 0.0);
+                    break;
+                }
+                d    = format_digits(end, (uintptr_t)ptr, 16, 0);
+                *--d = 'x';
+                *--d = '0';
+                format_field(&o, sp, "", 0, 0, d, (size_t)(end - d), 0);
+                break;
+            }
+
+            case 'f':
+            case 'F':
+            {
+                double v = va_arg(args, double);
+
+                /* The decimal point follows LC_NUMERIC, like vsnprintf() */
+                if (!point)
+                    point = localeconv()->decimal_point;
+                if (!format_float(&o, sp, v, point))
+                    format_fallback(&o, sp, NULL, v);
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    va_end(args);
+
+    if (size)
+        buf[o.len < size ? o.len : size - 1] = '\0';
+
+    return o.len > INT_MAX ? -1 : (int)o.len;
+}
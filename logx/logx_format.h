@@ -0,0 +1,102 @@
+/**
+ * @file logx_format.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Pre-parsed format strings — the `fmt` of a call site split once into
+ *        literal chunks and conversion specs, and run by a specialized formatter.
+ *
+ * `vsnprintf()` parses its format string on every call, although the format of a
+ * `LOGX_*` call site is a string literal that never changes. The first record of
+ * a site parses it into a list of specs, cached in the site by the format's
+ * address; later records run the list.
+ *
+ * The formatter handles the `d`, `i`, `u`, `x`, `X`, `o`, `c`, `s`, `p`, `f` and
+ * `F` conversions with the `-`, `+`, space, `#` and `0` flags, literal widths and
+ * precisions, and the `hh`, `h`, `l`, `ll`, `z`, `j` and `t` length modifiers,
+ * and produces exactly what `vsnprintf()` produces. A format using anything else
+ * (`*`, `%n`, `%e`, `%g`, `%m`, positional arguments, wide characters, ...) is
+ * left to `vsnprintf()`. So are single values the fast paths do not cover: a NULL
+ * `%s` or `%p`, a non-finite or very large `%f`, `%f` under a locale whose decimal
+ * point is not `.` or with a rounding mode other than to-nearest.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_FORMAT_H
+#define LOGX_FORMAT_H
+
+#include "logx_callsite.h"
+#include "logx_errorcodes.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Longest conversion spec (`%-+08.3lld` and the like) the formatter handles. */
+#define LOGX_FORMAT_SPEC_MAX 32
+
+/**
+ * @brief One step of a parsed format: copy `text`, then format one argument per `conv`.
+ */
+typedef struct
+{
+    const char *text; /**< Literal text, inside the format string. */
+    size_t len;       /**< Length of `text`. */
+    const char *spec; /**< The conversion as written, from its `%` (per-value fallback). */
+    uint8_t spec_len; /**< Length of `spec`. */
+    char conv;        /**< Conversion character, or 0 for text only. */
+    uint8_t length;   /**< Length modifier (`logx_format.c`). */
+    uint8_t flags;    /**< Flag bits (`logx_format.c`). */
+    int width;        /**< Minimum field width, 0 if none. */
+    int prec;         /**< Precision, -1 if none. */
+} logx_format_spec_t;
+
+/**
+ * @brief A parsed format string. Immutable once parsed.
+ */
+typedef struct logx_format
+{
+    const char *fmt;            /**< Format string it was parsed from (the cache key). */
+    size_t count;               /**< Number of specs. */
+    logx_format_spec_t specs[]; /**< Specs, in order. */
+} logx_format_t;
+
+/**
+ * @brief Internal — parse a format string.
+ * @internal
+ *
+ * The result points into `fmt`, which must outlive it (a string literal).
+ *
+ * @param[in]  fmt printf-style format string.
+ * @param[out] out Parsed format (free with `free()`), or NULL if the format uses
+ *                 anything the formatter does not handle.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_NO_MEM`.
+ */
+logx_errorcodes_t logx_format_compile(const char *fmt, logx_format_t **out);
+
+/**
+ * @brief Internal — parsed format of a call site, parsed on the site's first record.
+ * @internal
+ *
+ * Parsed formats are kept for the life of the process, like the site.
+ *
+ * @param[in,out] site Call site.
+ * @param[in]     fmt  Format string of the record; a string literal.
+ * @return The parsed format, or NULL to format with `vsnprintf()`.
+ */
+const logx_format_t *logx_format_site(logx_callsite_t *site, const char *fmt);
+
+/**
+ * @brief Internal — `vsnprintf()` run from a parsed format.
+ * @internal
+ *
+ * @param[in]  f    Parsed format.
+ * @param[out] buf  Destination; receives at most `size - 1` bytes and a NUL.
+ * @param[in]  size Size of `buf` in bytes (may be 0).
+ * @param[in]  ap   Arguments, as for `vsnprintf()`.
+ * @return Length of the full output, as `vsnprintf()` returns it.
+ */
+int logx_format_vsnprintf(const logx_format_t *f, char *buf, size_t size, va_list ap);
+
+#endif /* LOGX_FORMAT_H */
@@ -0,0 +1,570 @@
+/**
+ * @file logx_layout.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Record layouts compiled to operation lists.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "logx_layout.h"
+#include "logx_common.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/** @brief Widest number a layout writes (a 64-bit value in decimal). */
+#define LAYOUT_NUM_MAX 20
+
+/** @brief Token kinds that only exist while compiling; folded into text per level. */
+enum
+{
+    LAYOUT_TOK_LEVEL = LOGX_LAYOUT_OP_COUNT, /**< `%L`. */
+    LAYOUT_TOK_NAME                          /**< `%n`. */
+};
+
+/**
+ * @brief One conversion or run of literal text of a parsed pattern.
+ */
+typedef struct
+{
+    int kind;         /**< `logx_layout_op_kind_t` or `LAYOUT_TOK_*`. */
+    const char *text; /**< Literal text inside the pattern (TEXT only). */
+    size_t len;       /**< Length of `text`. */
+} layout_tok_t;
+
+static pid_t g_layout_pid;
+static pthread_once_t g_layout_pid_once = PTHREAD_ONCE_INIT;
+
+/** @brief Fork handler — the child looks its process ID up again. */
+static void layout_pid_reset(void)
+{
+    __atomic_store_n(&g_layout_pid, 0, __ATOMIC_RELAXED);
+}
+
+/** @brief Register the fork handler that keeps the cached process ID right. */
+static void layout_pid_init(void)
+{
+    pthread_atfork(NULL, NULL, layout_pid_reset);
+}
+
+/** @brief Process ID, cached until the next fork (`getpid()` is a system call). */
+static pid_t layout_pid(void)
+{
+    pid_t pid = __atomic_load_n(&g_layout_pid, __ATOMIC_RELAXED);
+
+    if (!pid)
+    {
+        pid = getpid();
+        __atomic_store_n(&g_layout_pid, pid, __ATOMIC_RELAXED);
+    }
+    return pid;
+}
+
+/** @brief 1 if a token is constant for a given logger and level. */
+static int layout_tok_const(int kind)
+{
+    return kind == LOGX_LAYOUT_OP_TEXT || kind == LAYOUT_TOK_LEVEL || kind == LAYOUT_TOK_NAME;
+}
+
+/** @brief 1 if `t` is literal text consisting of a single `:`. */
+static int layout_tok_colon(const layout_tok_t *t)
+{
+    return t->kind == LOGX_LAYOUT_OP_TEXT && t->len == 1 && t->text[0] == ':';
+}
+
+/**
+ * @brief Replace every `%f:%F:%l` with one LOC token, which copies the call site's
+ *        cached location text as a whole.
+ *
+ * @param[in,out] toks  Tokens.
+ * @param[in,out] count Number of tokens.
+ */
+static void layout_fuse_loc(layout_tok_t *toks, size_t *count)
+{
+    size_t n = 0;
+
+    for (size_t i = 0; i < *count; i++)
+    {
+        if (i + 4 < *count && toks[i].kind == LOGX_LAYOUT_OP_FILE &&
+            layout_tok_colon(&toks[i + 1]) && toks[i + 2].kind == LOGX_LAYOUT_OP_FUNC &&
+            layout_tok_colon(&toks[i + 3]) && toks[i + 4].kind == LOGX_LAYOUT_OP_LINE)
+        {
+            toks[n++] = (layout_tok_t){LOGX_LAYOUT_OP_LOC, NULL, 0};
+            i += 4;
+            continue;
+        }
+        toks[n++] = toks[i];
+    }
+
+    *count = n;
+}
+
+/**
+ * @brief Split a pattern into tokens. A pattern without `%m` gets a space and the
+ *        message appended, unless it already ends with a space.
+ *
+ * @param[in]  pattern Layout pattern.
+ * @param[out] toks    Tokens, room for `strlen(pattern) + 2`.
+ * @param[out] count   Number of tokens.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` for an invalid pattern.
+ */
+static logx_errorcodes_t layout_parse(const char *pattern, layout_tok_t *toks, size_t *count)
+{
+    const char *p = pattern;
+    size_t n      = 0;
+    int has_msg   = 0;
+
+    while (*p)
+    {
+        const char *start = p;
+        int kind          = 0;
+
+        if (*p != '%')
+        {
+            while (*p && *p != '%')
+                p++;
+            toks[n++] = (layout_tok_t){LOGX_LAYOUT_OP_TEXT, start, (size_t)(p - start)};
+            continue;
+        }
+
+        switch (p[1])
+        {
+        case '%':
+            toks[n++] = (layout_tok_t){LOGX_LAYOUT_OP_TEXT, p + 1, 1};
+            p += 2;
+            continue;
+        case 'T':
+            kind = LOGX_LAYOUT_OP_TS;
+            break;
+        case 'L':
+            kind = LAYOUT_TOK_LEVEL;
+            break;
+        case 'n':
+            kind = LAYOUT_TOK_NAME;
+            break;
+        case 'f':
+            kind = LOGX_LAYOUT_OP_FILE;
+            break;
+        case 'F':
+            kind = LOGX_LAYOUT_OP_FUNC;
+            break;
+        case 'l':
+            kind = LOGX_LAYOUT_OP_LINE;
+            break;
+        case 't':
+            kind = LOGX_LAYOUT_OP_TID;
+            break;
+        case 'P':
+            kind = LOGX_LAYOUT_OP_PID;
+            break;
+        case 'N':
+            kind = LOGX_LAYOUT_OP_SEQ;
+            break;
+        case 'm':
+            if (has_msg)
+                return LOGX_ERR_INVALID_ARG;
+            has_msg = 1;
+            kind    = LOGX_LAYOUT_OP_MSG;
+            break;
+        default: /* Unknown conversion or a lone '%' at the end */
+            return LOGX_ERR_INVALID_ARG;
+        }
+
+        toks[n++] = (layout_tok_t){kind, NULL, 0};
+        p += 2;
+    }
+
+    if (!has_msg)
+    {
+        if (p == pattern || p[-1] != ' ')
+            toks[n++] = (layout_tok_t){LOGX_LAYOUT_OP_TEXT, " ", 1};
+        toks[n++] = (layout_tok_t){LOGX_LAYOUT_OP_MSG, NULL, 0};
+    }
+
+    *count = n;
+    layout_fuse_loc(toks, count);
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Find where the syslog format starts: after the leading timestamp and level
+ *        tag, keeping the part of the literal after them that opens the next field.
+ *
+ * @param[in]  toks  Tokens.
+ * @param[in]  count Number of tokens.
+ * @param[out] skip  Bytes of the returned token left out.
+ * @return Index of the token the syslog format starts in.
+ */
+static size_t layout_syslog_start(const layout_tok_t *toks, size_t count, size_t *skip)
+{
+    size_t start = 0;
+
+    *skip = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (toks[i].kind == LOGX_LAYOUT_OP_TS || toks[i].kind == LAYOUT_TOK_LEVEL)
+            start = i + 1;
+        else if (toks[i].kind != LOGX_LAYOUT_OP_TEXT)
+            break;
+    }
+
+    if (start == 0 || toks[start].kind != LOGX_LAYOUT_OP_TEXT)
+        return start;
+
+    /* "] [" keeps "[", " " keeps nothing, "][" keeps "[" */
+    const char *s = toks[start].text;
+    size_t len    = toks[start].len;
+
+    *skip = len;
+    for (size_t i = len; i > 0; i--)
+    {
+        if (s[i - 1] == ' ' || s[i - 1] == '\t')
+        {
+            *skip = i;
+            return start;
+        }
+    }
+    for (size_t i = len; i > 0; i--)
+    {
+        if (strchr("([{<", s[i - 1]))
+        {
+            *skip = i - 1;
+            break;
+        }
+    }
+    return start;
+}
+
+/**
+ * @brief Compile parsed tokens. Every field closes an operation that copies the text
+ *        in front of it, with the level tag and logger name folded into that text;
+ *        every level gets the same operations.
+ */
+static logx_errorcodes_t layout_build(logx_layout_t *l, const layout_tok_t *toks, size_t ntok,
+                                      const char *name)
+{
+    size_t name_len = strlen(name);
+    size_t per_lv   = 0;
+    size_t tags     = 0;
+    size_t sys_skip = 0;
+    size_t sys_tok  = layout_syslog_start(toks, ntok, &sys_skip);
+    char *pos       = NULL;
+    int open        = 0;
+
+    for (size_t i = 0; i < ntok; i++)
+    {
+        if (layout_tok_const(toks[i].kind))
+        {
+            open = 1;
+            per_lv += toks[i].kind == LAYOUT_TOK_NAME ? name_len : toks[i].len;
+        }
+        else
+        {
+            l->count++;
+            open = 0;
+            l->fields[toks[i].kind]++;
+        }
+    }
+    l->count += open; /* Text after the last field */
+
+    for (int lv = 0; lv < LOGX_LEVEL_COUNT; lv++)
+        for (size_t i = 0; i < ntok; i++)
+            if (toks[i].kind == LAYOUT_TOK_LEVEL)
+                tags += strlen(LOGX_LEVEL_MAP[lv].abbr);
+
+    l->buf = calloc(1, per_lv * LOGX_LEVEL_COUNT + tags);
+    l->ops = calloc(l->count * LOGX_LEVEL_COUNT, sizeof(*l->ops));
+    if (!l->buf || !l->ops)
+        return LOGX_ERR_NO_MEM;
+
+    pos = l->buf;
+    for (int lv = 0; lv < LOGX_LEVEL_COUNT; lv++)
+    {
+        logx_layout_op_t *ops = l->ops + (size_t)lv * l->count;
+        size_t n              = 0;
+
+        ops[0].text = pos;
+        for (size_t i = 0; i < ntok; i++)
+        {
+            const char *s = toks[i].text;
+            size_t len    = toks[i].len;
+
+            if (i == sys_tok)
+            {
+                l->sys_op       = n;
+                l->sys_skip[lv] = ops[n].len + sys_skip;
+            }
+
+            if (toks[i].kind == LAYOUT_TOK_LEVEL)
+            {
+                s   = LOGX_LEVEL_MAP[lv].abbr;
+                len = strlen(s);
+            }
+            else if (toks[i].kind == LAYOUT_TOK_NAME)
+            {
+                s   = name;
+                len = name_len;
+            }
+            else if (toks[i].kind != LOGX_LAYOUT_OP_TEXT)
+            {
+                ops[n++].kind = (logx_layout_op_kind_t)toks[i].kind;
+                if (n < l->count)
+                    ops[n].text = pos;
+                continue;
+            }
+
+            memcpy(pos, s, len);
+            pos += len;
+            ops[n].len += len;
+            l->text_len[lv] += len;
+        }
+    }
+
+    if (l->fields[LOGX_LAYOUT_OP_TS])
+        l->uses |= LOGX_LAYOUT_USES_TS;
+    if (l->fields[LOGX_LAYOUT_OP_SEQ])
+        l->uses |= LOGX_LAYOUT_USES_SEQ;
+    if (l->fields[LOGX_LAYOUT_OP_FILE] || l->fields[LOGX_LAYOUT_OP_FUNC] ||
+        l->fields[LOGX_LAYOUT_OP_LINE] || l->fields[LOGX_LAYOUT_OP_LOC])
+        l->uses |= LOGX_LAYOUT_USES_LOC;
+    if (l->fields[LOGX_LAYOUT_OP_PID])
+        pthread_once(&g_layout_pid_once, layout_pid_init);
+
+    return LOGX_ERR_SUCCESS;
+}
+
+logx_errorcodes_t logx_layout_compile(logx_layout_t *l, const char *pattern, const char *name)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    layout_tok_t *toks     = NULL;
+    size_t ntok            = 0;
+    size_t room            = 0;
+
+    memset(l, 0, sizeof(*l));
+
+    /* Same text the old "[%s]" conversion produced for a NULL name */
+    if (!name)
+        name = "(null)";
+    if (!pattern || !*pattern)
+        pattern = LOGX_LAYOUT_DEFAULT;
+
+    room = strlen(pattern) > strlen(LOGX_LAYOUT_DEFAULT) ? strlen(pattern)
+                                                          : strlen(LOGX_LAYOUT_DEFAULT);
+    toks = malloc((room + 2) * sizeof(*toks));
+    if (!toks)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    if (layout_parse(pattern, toks, &ntok) != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "[LogX] Invalid layout_pattern \"%s\", using \"%s\"\n", pattern,
+                LOGX_LAYOUT_DEFAULT);
+        layout_parse(LOGX_LAYOUT_DEFAULT, toks, &ntok);
+    }
+
+    eErr = layout_build(l, toks, ntok, name);
+
+END:
+    free(toks);
+    if (eErr != LOGX_ERR_SUCCESS)
+        logx_layout_free(l);
+    return eErr;
+}
+
+void logx_layout_free(logx_layout_t *l)
+{
+    free(l->buf);
+    free(l->ops);
+    memset(l, 0, sizeof(*l));
+}
+
+logx_errorcodes_t logx_layout_view_new(logx_layout_view_t **out, const char *pattern,
+                                       const char *banner, const char *name)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_layout_view_t *v  = calloc(1, sizeof(*v));
+
+    if (!v)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    v->banner = strdup((banner && *banner) ? banner : "=");
+    if (!v->banner)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    eErr = logx_layout_compile(&v->layout, pattern, name);
+
+END:
+    if (eErr != LOGX_ERR_SUCCESS)
+    {
+        logx_layout_view_free(v);
+        v = NULL;
+    }
+    *out = v;
+    return eErr;
+}
+
+void logx_layout_view_free(logx_layout_view_t *v)
+{
+    if (!v)
+        return;
+    logx_layout_free(&v->layout);
+    free(v->banner);
+    free(v);
+}
+
+/* ── Reader grace periods ────────────────────────────────────────────────── */
+
+unsigned int logx_layout_guard_enter(logx_layout_guard_t *g)
+{
+    for (;;)
+    {
+        unsigned int epoch  = __atomic_load_n(&g->epoch, __ATOMIC_SEQ_CST);
+        unsigned int bucket = epoch & 1U;
+
+        __atomic_fetch_add(&g->readers[bucket], 1, __ATOMIC_SEQ_CST);
+
+        /* A writer that moved on in between may already have found the bucket empty */
+        if (__atomic_load_n(&g->epoch, __ATOMIC_SEQ_CST) == epoch)
+            return bucket;
+        __atomic_fetch_sub(&g->readers[bucket], 1, __ATOMIC_RELEASE);
+    }
+}
+
+void logx_layout_guard_leave(logx_layout_guard_t *g, unsigned int bucket)
+{
+    __atomic_fetch_sub(&g->readers[bucket], 1, __ATOMIC_RELEASE);
+}
+
+void logx_layout_guard_wait(logx_layout_guard_t *g)
+{
+    unsigned int bucket       = __atomic_fetch_add(&g->epoch, 1, __ATOMIC_SEQ_CST) & 1U;
+    const struct timespec nap = {.tv_sec = 0, .tv_nsec = 100000};
+
+    /* Readers only render a record in there, so this is short */
+    while (__atomic_load_n(&g->readers[bucket], __ATOMIC_ACQUIRE) != 0)
+        nanosleep(&nap, NULL);
+}
+
+/**
+ * @brief A field value ready to copy.
+ */
+typedef struct
+{
+    const char *s; /**< Value text. */
+    size_t len;    /**< Length of the value. */
+} layout_val_t;
+
+/** @brief Room for one number, written right-aligned. */
+typedef struct
+{
+    char buf[LAYOUT_NUM_MAX];
+} layout_num_t;
+
+/**
+ * @brief Write the decimal digits of `v` right-aligned in `num`.
+ * @return The digits inside `num`.
+ */
+static layout_val_t layout_num(layout_num_t *num, uint64_t v)
+{
+    char *end = num->buf + sizeof(num->buf);
+    char *p   = end;
+
+    /* 32-bit division is cheaper; thread and process IDs fit */
+    while (v > UINT32_MAX)
+    {
+        *--p = (char)('0' + v % 10);
+        v /= 10;
+    }
+    uint32_t w = (uint32_t)v;
+    do
+    {
+        *--p = (char)('0' + w % 10);
+        w /= 10;
+    } while (w);
+
+    return (layout_val_t){p, (size_t)(end - p)};
+}
+
+logx_errorcodes_t logx_layout_render(const logx_layout_t *l, logx_scratch_buf_t *out,
+                                     const logx_layout_fields_t *fields, logx_layout_span_t *span)
+{
+    const logx_layout_op_t *ops    = l->ops + (size_t)fields->level * l->count;
+    const size_t *cnt              = l->fields;
+    const logx_callsite_loc_t *loc = &fields->loc;
+    size_t sys_op                  = l->sys_op;
+    size_t sys_skip                = l->sys_skip[fields->level];
+    size_t at[LOGX_LAYOUT_OP_COUNT];
+    size_t need = 0;
+    size_t n    = 0;
+    char *o     = NULL;
+    layout_num_t nums[3];
+    layout_val_t val[LOGX_LAYOUT_OP_COUNT];
+
+    /* Every field is resolved to text first, so running the operations is plain copying */
+    val[LOGX_LAYOUT_OP_TEXT] = (layout_val_t){"", 0};
+    val[LOGX_LAYOUT_OP_MSG]  = (layout_val_t){"", 0};
+
+    if (cnt[LOGX_LAYOUT_OP_TS])
+        val[LOGX_LAYOUT_OP_TS] = (layout_val_t){fields->ts, strlen(fields->ts)};
+    if (l->uses & LOGX_LAYOUT_USES_LOC)
+    {
+        /* The call-site fields are slices of "file:func:line" */
+        size_t line_off = loc->file_len + loc->func_len + 2;
+
+        val[LOGX_LAYOUT_OP_FILE] = (layout_val_t){loc->text, loc->file_len};
+        val[LOGX_LAYOUT_OP_FUNC] = (layout_val_t){loc->text + loc->file_len + 1, loc->func_len};
+        val[LOGX_LAYOUT_OP_LINE] = (layout_val_t){loc->text + line_off, loc->len - line_off};
+        val[LOGX_LAYOUT_OP_LOC]  = (layout_val_t){loc->text, loc->len};
+    }
+    if (cnt[LOGX_LAYOUT_OP_TID])
+        val[LOGX_LAYOUT_OP_TID] =
+            layout_num(&nums[0], fields->tid ? fields->tid : logx_thread_id());
+    if (cnt[LOGX_LAYOUT_OP_PID])
+        val[LOGX_LAYOUT_OP_PID] = layout_num(&nums[1], (uint64_t)layout_pid());
+    if (cnt[LOGX_LAYOUT_OP_SEQ])
+        val[LOGX_LAYOUT_OP_SEQ] = layout_num(&nums[2], fields->seq);
+
+    need = l->text_len[fields->level];
+    for (int k = LOGX_LAYOUT_OP_TS; k < LOGX_LAYOUT_OP_MSG; k++)
+        if (cnt[k])
+            need += cnt[k] * val[k].len;
+
+    o = logx_scratch_reserve(out, need + 1);
+    if (!o)
+        return LOGX_ERR_NO_MEM;
+
+    span->sys_off = 0;
+
+    for (size_t i = 0; i < l->count; i++)
+    {
+        const logx_layout_op_t op = ops[i];
+        const layout_val_t *v     = &val[op.kind];
+
+        if (i == sys_op)
+            span->sys_off = n + sys_skip;
+
+        memcpy(o + n, op.text, op.len);
+        n += op.len;
+        at[op.kind] = n;
+        memcpy(o + n, v->s, v->len);
+        n += v->len;
+    }
+
+    o[n]          = '\0';
+    span->len     = n;
+    span->msg_off = at[LOGX_LAYOUT_OP_MSG];
+    return LOGX_ERR_SUCCESS;
+}
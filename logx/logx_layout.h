@@ -0,0 +1,238 @@
+/**
+ * @file logx_layout.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Record layouts — the `layout_pattern` of a logger compiled into a list of
+ *        copy and emit operations.
+ *
+ * A layout pattern is text with conversions:
+ *
+ * | Conversion | Replaced by                                   |
+ * |------------|-----------------------------------------------|
+ * | `%T`       | Timestamp, in the logger's `timestamp_format` |
+ * | `%L`       | Level tag (`INF`, `ERR`, ...)                 |
+ * | `%n`       | Logger name                                   |
+ * | `%f`       | Call-site file                                |
+ * | `%F`       | Call-site function                            |
+ * | `%l`       | Call-site line                                |
+ * | `%t`       | Thread ID of the logging thread               |
+ * | `%P`       | Process ID                                    |
+ * | `%N`       | Sequence number of the record in the logger   |
+ * | `%m`       | Message                                       |
+ * | `%%`       | `%`                                           |
+ *
+ * The pattern is compiled once, when the logger is created or reloaded. The level
+ * tag and logger name never change for a given logger and level, so they are
+ * folded into the surrounding text, giving one operation list per level in which
+ * every operation copies constant text and then writes one per-record field.
+ * Writing a record runs that list without interpreting the pattern again.
+ *
+ * The call-site fields are slices of the site's cached `file:func:line` text, and
+ * `%f:%F:%l` is compiled to a single copy of that text.
+ *
+ * Without `%m`, the message follows the layout after a space. The syslog format
+ * leaves out the timestamp and level tag, which syslog records itself: it starts
+ * at the first other field, together with the bracket or text directly in front
+ * of it.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_LAYOUT_H
+#define LOGX_LAYOUT_H
+
+#include "logx_callsite.h"
+#include "logx_errorcodes.h"
+#include "logx_scratch.h"
+#include "logx_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Layout used when `layout_pattern` is not set. */
+#define LOGX_LAYOUT_DEFAULT "[%T] [%L] [%n] (%f:%F:%l): %m"
+
+/** @brief Size of the timestamp buffer handed to `logx_layout_render()`. */
+#define LOGX_LAYOUT_TS_SIZE 64
+
+/** @brief `logx_layout_t::uses` bit: the layout contains `%T`. */
+#define LOGX_LAYOUT_USES_TS  (1U << 0)
+/** @brief `logx_layout_t::uses` bit: the layout contains `%N`. */
+#define LOGX_LAYOUT_USES_SEQ (1U << 1)
+/** @brief `logx_layout_t::uses` bit: the layout contains `%f`, `%F` or `%l`. */
+#define LOGX_LAYOUT_USES_LOC (1U << 2)
+
+/**
+ * @brief Operation kinds of a compiled layout.
+ */
+typedef enum
+{
+    LOGX_LAYOUT_OP_TEXT = 0, /**< No field (text after the last field). */
+    LOGX_LAYOUT_OP_TS,       /**< Timestamp. */
+    LOGX_LAYOUT_OP_FILE,     /**< Call-site file. */
+    LOGX_LAYOUT_OP_FUNC,     /**< Call-site function. */
+    LOGX_LAYOUT_OP_LINE,     /**< Call-site line. */
+    LOGX_LAYOUT_OP_LOC,      /**< Call-site `file:func:line`. */
+    LOGX_LAYOUT_OP_TID,      /**< Thread ID. */
+    LOGX_LAYOUT_OP_PID,      /**< Process ID. */
+    LOGX_LAYOUT_OP_SEQ,      /**< Sequence number. */
+    LOGX_LAYOUT_OP_MSG,      /**< Position of the message. */
+    LOGX_LAYOUT_OP_COUNT     /**< Number of operation kinds. */
+} logx_layout_op_kind_t;
+
+/**
+ * @brief One operation of a compiled layout: copy `text`, then write field `kind`.
+ */
+typedef struct
+{
+    logx_layout_op_kind_t kind; /**< Field written after the text. */
+    size_t len;                 /**< Length of `text`. */
+    const char *text;           /**< Constant text inside `logx_layout_t::buf`. */
+} logx_layout_op_t;
+
+/**
+ * @brief A compiled layout. Immutable once compiled.
+ */
+typedef struct
+{
+    char *buf;                           /**< Constant text of every operation. */
+    logx_layout_op_t *ops;               /**< `count` operations per level, by level. */
+    size_t count;                        /**< Operations per level. */
+    size_t sys_op;                       /**< Operation where the syslog format starts. */
+    size_t sys_skip[LOGX_LEVEL_COUNT];   /**< Bytes of `sys_op` it leaves out. */
+    size_t text_len[LOGX_LEVEL_COUNT];   /**< Constant text written per level. */
+    size_t fields[LOGX_LAYOUT_OP_COUNT]; /**< Number of operations of each kind. */
+    unsigned int uses;                   /**< `LOGX_LAYOUT_USES_*` bits. */
+} logx_layout_t;
+
+/**
+ * @brief Per-record values a layout writes.
+ */
+typedef struct
+{
+    const char *ts;          /**< Timestamp (layouts with `%T`). */
+    logx_level_t level;      /**< Record level (a valid level). */
+    logx_callsite_loc_t loc; /**< Call-site location (layouts with `%f`, `%F` or `%l`). */
+    unsigned long tid;       /**< Thread ID of the logging thread, 0 for the calling thread. */
+    uint64_t seq;            /**< Sequence number (layouts with `%N`). */
+} logx_layout_fields_t;
+
+/**
+ * @brief Where the parts of a rendered layout are.
+ *
+ * The layout text is `[0, msg_off)` before the message and `[msg_off, len)` after it.
+ */
+typedef struct
+{
+    size_t len;     /**< Length of the rendered layout, message excluded. */
+    size_t msg_off; /**< Offset where the message goes. */
+    size_t sys_off; /**< Offset where the syslog format starts (at most `msg_off`). */
+} logx_layout_span_t;
+
+/**
+ * @brief Everything a logger renders records with that a reload replaces.
+ *
+ * Published through `logx_t::view` and never changed once published; a reload
+ * swaps in a new one and frees the old one after `logx_layout_guard_wait()`.
+ */
+typedef struct
+{
+    logx_layout_t layout; /**< Compiled `layout_pattern`. */
+    char *banner;         /**< Banner border pattern, never empty (owned). */
+} logx_layout_view_t;
+
+/**
+ * @brief Grace-period tracking for readers of a published `logx_layout_view_t`.
+ *
+ * Readers count themselves in the bucket of the current epoch. A writer that has
+ * unpublished a view moves to the next epoch and waits for the old bucket to
+ * drain; readers arriving meanwhile use the other bucket, so they cannot hold the
+ * writer up.
+ */
+typedef struct
+{
+    unsigned int epoch;      /**< Current epoch; its low bit selects the bucket. */
+    unsigned int readers[2]; /**< Readers inside a section, by bucket. */
+} logx_layout_guard_t;
+
+/**
+ * @brief Internal — compile a layout pattern for a logger.
+ * @internal
+ *
+ * An invalid pattern (an unknown conversion, a lone `%` or a second `%m`) is
+ * reported on stderr and `LOGX_LAYOUT_DEFAULT` is used instead.
+ *
+ * @param[out] l       Compiled layout.
+ * @param[in]  pattern Layout pattern, or NULL/empty for `LOGX_LAYOUT_DEFAULT`.
+ * @param[in]  name    Logger name, or NULL.
+ * @return `LOGX_ERR_SUCCESS` or `LOGX_ERR_NO_MEM`.
+ */
+logx_errorcodes_t logx_layout_compile(logx_layout_t *l, const char *pattern, const char *name);
+
+/**
+ * @brief Internal — free a compiled layout.
+ * @internal
+ * @param[in,out] l Compiled layout.
+ */
+void logx_layout_free(logx_layout_t *l);
+
+/**
+ * @brief Internal — compile a layout pattern and copy a banner pattern into a new view.
+ * @internal
+ * @param[out] out     Receives the view.
+ * @param[in]  pattern Layout pattern, or NULL/empty for `LOGX_LAYOUT_DEFAULT`.
+ * @param[in]  banner  Banner border pattern, or NULL/empty for `"="`.
+ * @param[in]  name    Logger name, or NULL.
+ * @return `LOGX_ERR_SUCCESS` or `LOGX_ERR_NO_MEM`.
+ */
+logx_errorcodes_t logx_layout_view_new(logx_layout_view_t **out, const char *pattern,
+                                       const char *banner, const char *name);
+
+/**
+ * @brief Internal — free a view no reader can reach any more.
+ * @internal
+ * @param[in] v View, or NULL.
+ */
+void logx_layout_view_free(logx_layout_view_t *v);
+
+/**
+ * @brief Internal — enter a read section before loading a published view.
+ * @internal
+ * @param[in,out] g Guard of the view.
+ * @return Bucket to pass to `logx_layout_guard_leave()`.
+ */
+unsigned int logx_layout_guard_enter(logx_layout_guard_t *g);
+
+/**
+ * @brief Internal — leave a read section; the view may be freed afterwards.
+ * @internal
+ * @param[in,out] g      Guard of the view.
+ * @param[in]     bucket Value returned by `logx_layout_guard_enter()`.
+ */
+void logx_layout_guard_leave(logx_layout_guard_t *g, unsigned int bucket);
+
+/**
+ * @brief Internal — wait until no reader can still use a view that was unpublished
+ *        before the call.
+ * @internal
+ *
+ * Callers must not wait on the same guard concurrently.
+ *
+ * @param[in,out] g Guard of the view.
+ */
+void logx_layout_guard_wait(logx_layout_guard_t *g);
+
+/**
+ * @brief Internal — run the operations of a layout for one record.
+ * @internal
+ * @param[in]     l      Compiled layout.
+ * @param[in,out] out    Scratch buffer that receives the NUL-terminated layout text.
+ * @param[in]     fields Values of the record.
+ * @param[out]    span   Receives the length and offsets of the rendered text.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_NO_MEM` if `out` cannot grow.
+ */
+logx_errorcodes_t logx_layout_render(const logx_layout_t *l, logx_scratch_buf_t *out,
+                                     const logx_layout_fields_t *fields, logx_layout_span_t *span);
+
+#endif /* LOGX_LAYOUT_H */
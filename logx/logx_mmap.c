@@ -0,0 +1,268 @@
+/**
+ * @file logx_mmap.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Memory-mapped file sink — window mapping, crash recovery and rotation.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "logx_mmap.h"
+#include "logx.h"
+#include "logx_common.h"
+#include "logx_rotation.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief State of one mmap sink. Owned by the sink once it is attached.
+ */
+typedef struct
+{
+    char *path;      /**< Log file (owned). */
+    int fd;          /**< Open descriptor, or -1. */
+    char *map;       /**< Current window, or NULL. */
+    size_t window;   /**< Window size; a multiple of the page size. */
+    off_t map_off;   /**< File offset of the current window. */
+    off_t tail;      /**< End of the written content. */
+    size_t max_size; /**< Rotation threshold; 0 = never. */
+    int max_backups; /**< Backups kept on rotation. */
+    int compress;    /**< gzip backups on rotation. */
+    int attached;    /**< Set once the sink owns this context. */
+} logx_mmap_ctx_t;
+
+/**
+ * @brief Find the end of the content of a file that may end in NUL padding.
+ * @return Offset just past the last non-NUL byte.
+ */
+static off_t mmap_recover_tail(int fd, off_t size)
+{
+    char buf[4096];
+
+    while (size > 0)
+    {
+        size_t n = (size_t)size < sizeof(buf) ? (size_t)size : sizeof(buf);
+        if (pread(fd, buf, n, size - (off_t)n) != (ssize_t)n)
+            break;
+        for (size_t i = n; i > 0; i--)
+        {
+            if (buf[i - 1] != '\0')
+                return size - (off_t)(n - i);
+        }
+        size -= (off_t)n;
+    }
+    return size;
+}
+
+/**
+ * @brief Reserve and map the window that contains the current tail.
+ */
+static logx_errorcodes_t mmap_map_window(logx_mmap_ctx_t *m)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    void *p   = NULL;
+
+    m->map_off = m->tail - (m->tail % (off_t)page);
+
+    /* Allocating the blocks up front turns a full disk into an error, not a SIGBUS */
+    if (posix_fallocate(m->fd, m->map_off, (off_t)m->window) != 0)
+        return LOGX_ERR_FILE_WRITE_FAILED;
+
+    p = mmap(NULL, m->window, PROT_READ | PROT_WRITE, MAP_SHARED, m->fd, m->map_off);
+    if (p == MAP_FAILED)
+        return LOGX_ERR_FILE_WRITE_FAILED;
+
+    m->map = p;
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Unmap the window, trim the padding and close the file.
+ */
+static void mmap_close_file(logx_mmap_ctx_t *m)
+{
+    if (m->map)
+    {
+        munmap(m->map, m->window);
+        m->map = NULL;
+    }
+    if (m->fd >= 0)
+    {
+        if (ftruncate(m->fd, m->tail) != 0)
+            fprintf(stderr, "[LogX] Failed to trim %s\n", m->path);
+        close(m->fd);
+        m->fd = -1;
+    }
+}
+
+/**
+ * @brief Open the file, resume after its last record and map the first window.
+ */
+static logx_errorcodes_t mmap_open_file(logx_mmap_ctx_t *m)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    struct stat st;
+
+    ensure_parent_dir_exists(m->path);
+
+    m->fd = open(m->path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m->fd < 0)
+    {
+        eErr = LOGX_ERR_FILE_OPEN_FAILED;
+        goto END;
+    }
+
+    if (fstat(m->fd, &st) != 0)
+    {
+        eErr = LOGX_ERR_FSTAT_FAILED;
+        goto END;
+    }
+    m->tail = mmap_recover_tail(m->fd, st.st_size);
+
+    eErr = mmap_map_window(m);
+
+END:
+    if (eErr != LOGX_ERR_SUCCESS)
+        mmap_close_file(m);
+    return eErr;
+}
+
+/**
+ * @brief Close the file, rotate it and start a new one.
+ */
+static logx_errorcodes_t mmap_rotate(logx_mmap_ctx_t *m)
+{
+    mmap_close_file(m);
+    logx_rotate_files(m->path, m->max_backups, m->compress, 0);
+    return mmap_open_file(m);
+}
+
+/**
+ * @brief Copy records into the mapping, moving the window and rotating as needed.
+ */
+static logx_errorcodes_t mmap_write_batch(void *ctx, const logx_sink_record_t *records,
+                                          size_t count)
+{
+    logx_mmap_ctx_t *m = ctx;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const char *src = records[i].text;
+        size_t left     = records[i].len;
+
+        /* Retry a file or window that could not be set up earlier */
+        if (m->fd < 0 && mmap_open_file(m) != LOGX_ERR_SUCCESS)
+            return LOGX_ERR_FILE_WRITE_FAILED;
+        if (!m->map && mmap_map_window(m) != LOGX_ERR_SUCCESS)
+            return LOGX_ERR_FILE_WRITE_FAILED;
+
+        if (m->max_size && m->tail > 0 && (size_t)m->tail + left > m->max_size &&
+            mmap_rotate(m) != LOGX_ERR_SUCCESS)
+            return LOGX_ERR_FILE_WRITE_FAILED;
+
+        while (left > 0)
+        {
+            size_t room = (size_t)(m->map_off + (off_t)m->window - m->tail);
+            if (room == 0)
+            {
+                munmap(m->map, m->window);
+                m->map = NULL;
+                if (mmap_map_window(m) != LOGX_ERR_SUCCESS)
+                    return LOGX_ERR_FILE_WRITE_FAILED;
+                continue;
+            }
+
+            size_t n = left < room ? left : room;
+            memcpy(m->map + (m->tail - m->map_off), src, n);
+            m->tail += (off_t)n;
+            src += n;
+            left -= n;
+        }
+    }
+
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Trim and close the file; frees the context once the sink owns it.
+ */
+static void mmap_sink_close(void *ctx)
+{
+    logx_mmap_ctx_t *m = ctx;
+
+    mmap_close_file(m);
+    if (m->attached)
+    {
+        free(m->path);
+        free(m);
+    }
+}
+
+static const logx_sink_ops_t g_mmap_ops = {.write_batch = mmap_write_batch,
+                                           .close       = mmap_sink_close};
+
+logx_errorcodes_t logx_add_mmap_sink(logx_t *logger, const logx_mmap_sink_cfg_t *cfg,
+                                     logx_sink_t **out)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_mmap_ctx_t *m     = NULL;
+    logx_sink_t *sink      = NULL;
+    size_t page            = (size_t)sysconf(_SC_PAGESIZE);
+
+    /* Sanity check */
+    if (!logger || !cfg || !cfg->path || !*cfg->path)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    m = calloc(1, sizeof(*m));
+    if (!m || !(m->path = strdup(cfg->path)))
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+    m->fd          = -1;
+    m->max_size    = cfg->max_size;
+    m->max_backups = cfg->max_backups;
+    m->compress    = cfg->compress;
+    m->window      = cfg->window_size ? cfg->window_size : LOGX_MMAP_DEFAULT_WINDOW;
+    if (m->window < LOGX_MMAP_MIN_WINDOW)
+        m->window = LOGX_MMAP_MIN_WINDOW;
+    m->window = (m->window + page - 1) / page * page;
+
+    if ((eErr = mmap_open_file(m)) != LOGX_ERR_SUCCESS)
+        goto END;
+
+    logx_sink_cfg_t scfg = {.name        = "mmap",
+                            .level       = cfg->level,
+                            .format      = LOGX_SINK_FORMAT_PLAIN,
+                            .buffer_size = 0};
+
+    if ((eErr = logx_add_sink(logger, &g_mmap_ops, m, &scfg, &sink)) != LOGX_ERR_SUCCESS)
+        goto END;
+
+    pthread_mutex_lock(&logger->lock);
+    m->attached = 1;
+    pthread_mutex_unlock(&logger->lock);
+    m = NULL;
+
+END:
+    if (m)
+    {
+        mmap_close_file(m);
+        free(m->path);
+        free(m);
+    }
+    if (out)
+        *out = sink;
+    return eErr;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file logx_mmap.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Memory-mapped file sink — records are copied into a shared mapping of the
+ *        log file instead of going through stdio and write(2).
+ *
+ * The sink maps a window of the file (`window_size` bytes, 4 MiB by default) and
+ * appends each record with a plain `memcpy`. When the window is full it is
+ * unmapped and the next one is mapped right after it, so a system call is only
+ * made once per window. The space for a window is reserved with
+ * `posix_fallocate()` before it is mapped; a full disk is reported as a write
+ * error instead of a SIGBUS.
+ *
+ * The mapping is `MAP_SHARED`, so records live in the page cache as soon as they
+ * are copied and survive a crash of the process. They are not flushed to disk
+ * any earlier than with the stdio file sink.
+ *
+ * Caveats:
+ *  - Until the sink is closed or rotated, the file is longer than its content and
+ *    ends in NUL padding (visible to `tail -f`). On open, trailing NUL bytes left
+ *    by a crash are skipped and appending resumes after the last record.
+ *  - The file must not be truncated or written by anyone else while it is mapped.
+ *  - The sink rotates on its own `max_size`; `logx_rotate_now()` and the
+ *    `rotate` configuration only apply to the built-in file sink.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_MMAP_H
+#define LOGX_MMAP_H
+
+#include "logx_errorcodes.h"
+#include "logx_sink.h"
+#include "logx_types.h"
+#include <stddef.h>
+
+/** @brief Default mapping window of the mmap sink in bytes. */
+#ifndef LOGX_MMAP_DEFAULT_WINDOW
+#define LOGX_MMAP_DEFAULT_WINDOW (4u * 1024u * 1024u)
+#endif
+
+/** @brief Smallest mapping window accepted by the mmap sink in bytes. */
+#ifndef LOGX_MMAP_MIN_WINDOW
+#define LOGX_MMAP_MIN_WINDOW (64u * 1024u)
+#endif
+
+/**
+ * @brief Settings for `logx_add_mmap_sink()`.
+ */
+typedef struct
+{
+    const char *path;   /**< Log file to append to (copied). */
+    logx_level_t level; /**< Minimum level written to this sink. */
+    size_t window_size; /**< Bytes mapped at a time; 0 = `LOGX_MMAP_DEFAULT_WINDOW`. */
+    size_t max_size;    /**< Rotate once the file reaches this size; 0 = never. */
+    int max_backups;    /**< Backups kept on rotation (0 = truncate, no backup). */
+    int compress;       /**< 1 = gzip backups on rotation. */
+} logx_mmap_sink_cfg_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Attach a memory-mapped file sink to a logger.
+     *
+     * Records are written in the plain file format. The sink is removed with
+     * `logx_remove_sink()` or on `logx_destroy()`, which trims the file to its
+     * content.
+     *
+     * @param[in]  logger Pointer to the logger instance.
+     * @param[in]  cfg    Path, level, window and rotation settings.
+     * @param[out] out    Receives the sink handle (may be NULL).
+     * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_INVALID_ARG` on bad input,
+     *         `LOGX_ERR_NO_MEM`, `LOGX_ERR_FILE_OPEN_FAILED` if the file cannot be
+     *         opened, or `LOGX_ERR_FILE_WRITE_FAILED` if the first window cannot be
+     *         mapped.
+     */
+    logx_errorcodes_t logx_add_mmap_sink(logx_t *logger, const logx_mmap_sink_cfg_t *cfg,
+                                         logx_sink_t **out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGX_MMAP_H */
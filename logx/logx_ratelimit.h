@@ -0,0 +1,187 @@
+/**
+ * @file logx_ratelimit.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Lock-free per-call-site token bucket used by the rate-limited logging macros.
+ *
+ * The bucket is implemented as a GCRA (generic cell rate algorithm) which is
+ * equivalent to a token bucket with a refill interval and a burst size, but only
+ * needs one 64-bit word of state: the theoretical arrival time (TAT) of the next
+ * conforming message.
+ *
+ * A call inside the throttle window only reads the coarse monotonic clock and
+ * loads the TAT; it does not write shared state. Dropped calls are counted per
+ * thread and added to the shared counter when the thread passes, first sees a
+ * later window or has counted `LOGX_RATELIMIT_LOCAL_BATCH` of them.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_RATELIMIT_H
+#define LOGX_RATELIMIT_H
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief Clock used to skip the precise clock read inside the throttle window.
+ *
+ * It is updated once per tick, so it can trail `CLOCK_MONOTONIC` by up to a tick;
+ * `LOGX_RATELIMIT_COARSE_SLACK_NS` must cover that lag.
+ */
+#ifdef CLOCK_MONOTONIC_COARSE
+#define LOGX_RATELIMIT_COARSE_CLOCK CLOCK_MONOTONIC_COARSE
+#else
+#define LOGX_RATELIMIT_COARSE_CLOCK CLOCK_MONOTONIC
+#endif
+
+/** @brief Upper bound on the lag of the coarse clock (one tick at HZ=100). */
+#ifndef LOGX_RATELIMIT_COARSE_SLACK_NS
+#define LOGX_RATELIMIT_COARSE_SLACK_NS 10000000ULL
+#endif
+
+/** @brief Drops a thread counts before adding them to the shared counter. */
+#ifndef LOGX_RATELIMIT_LOCAL_BATCH
+#define LOGX_RATELIMIT_LOCAL_BATCH 64
+#endif
+
+/**
+ * @brief Per-call-site rate limiter state.
+ *
+ * Declared `static` by the `LOGX_*_FREQ` / `LOGX_*_RATE` macros; zero-initialised
+ * state means "bucket full". Accessed only through GCC/Clang `__atomic` builtins.
+ */
+typedef struct
+{
+    uint64_t tat_ns;     /**< Theoretical arrival time of the next conforming message (ns). */
+    uint64_t suppressed; /**< Messages dropped since the last one that was let through. */
+} logx_ratelimit_t;
+
+/**
+ * @brief Per-thread, per-call-site count of dropped messages.
+ *
+ * Declared `static LOGX_THREAD_LOCAL` next to the `logx_ratelimit_t` by the macros.
+ */
+typedef struct
+{
+    uint64_t tat_ns;  /**< TAT the pending drops were counted against. */
+    uint64_t pending; /**< Drops not yet added to `logx_ratelimit_t::suppressed`. */
+} logx_ratelimit_local_t;
+
+/**
+ * @brief Convert seconds (may be fractional) to nanoseconds, clamping negatives to 0.
+ * @param[in] sec Duration in seconds.
+ * @return Duration in nanoseconds.
+ */
+static inline uint64_t logx_ratelimit_sec_to_ns(double sec)
+{
+    if (!(sec > 0.0))
+        return 0;
+    if (sec >= 1.0e9) /* ~31 years — effectively "never again" */
+        return UINT64_MAX / 4;
+    return (uint64_t)(sec * 1.0e9);
+}
+
+/**
+ * @brief Convert a rate in messages per second to the refill interval in nanoseconds.
+ * @param[in] per_sec Sustained rate. Values <= 0 suppress every message after the burst.
+ * @return Refill interval in nanoseconds.
+ */
+static inline uint64_t logx_ratelimit_rate_to_ns(double per_sec)
+{
+    if (!(per_sec > 0.0))
+        return UINT64_MAX / 4;
+    return logx_ratelimit_sec_to_ns(1.0 / per_sec);
+}
+
+/**
+ * @brief Count one dropped message in the calling thread.
+ * @internal
+ *
+ * Drops counted against an earlier TAT are added to the shared counter first, so
+ * a thread that never passes still gets its drops reported by the next thread that
+ * does. A thread that exits inside a window takes fewer than
+ * `LOGX_RATELIMIT_LOCAL_BATCH` uncounted drops with it.
+ *
+ * @param[in,out] rl    Call-site state.
+ * @param[in,out] local Calling thread's state for the same call site.
+ * @param[in]     tat   TAT the call was throttled against.
+ */
+static inline void logx_ratelimit_drop(logx_ratelimit_t *rl, logx_ratelimit_local_t *local,
+                                       uint64_t tat)
+{
+    if (local->pending && local->tat_ns != tat)
+    {
+        __atomic_fetch_add(&rl->suppressed, local->pending, __ATOMIC_RELAXED);
+        local->pending = 0;
+    }
+    local->tat_ns = tat;
+    if (++local->pending >= LOGX_RATELIMIT_LOCAL_BATCH)
+    {
+        __atomic_fetch_add(&rl->suppressed, local->pending, __ATOMIC_RELAXED);
+        local->pending = 0;
+    }
+}
+
+/**
+ * @brief Try to take one token from a call-site bucket.
+ * @internal
+ *
+ * @param[in,out] rl          Call-site state.
+ * @param[in,out] local       Calling thread's state for the same call site.
+ * @param[in]     interval_ns Refill interval — one token per `interval_ns`. 0 = unlimited.
+ * @param[in]     burst       Bucket depth; at most `burst` messages pass back-to-back. 0 acts as 1.
+ * @param[out]    suppressed  On success, receives the number of messages dropped since the
+ *                            previous successful call (the counter is reset).
+ * @return 1 if the message should be logged, 0 if it should be suppressed.
+ */
+static inline int logx_ratelimit_acquire(logx_ratelimit_t *rl, logx_ratelimit_local_t *local,
+                                         uint64_t interval_ns, uint32_t burst,
+                                         uint64_t *suppressed)
+{
+    struct timespec ts;
+    uint64_t now, tol, tat, next;
+
+    /* The TAT may run ahead of `now` by at most (burst - 1) intervals */
+    tol = (burst > 1) ? interval_ns * (uint64_t)(burst - 1) : 0;
+    if (burst > 1 && tol / (uint64_t)(burst - 1) != interval_ns)
+        tol = UINT64_MAX / 4;
+
+    /* Fast path — well inside the window, the coarse clock is enough to tell */
+    tat = __atomic_load_n(&rl->tat_ns, __ATOMIC_RELAXED);
+    if (tat > tol && tat - tol > LOGX_RATELIMIT_COARSE_SLACK_NS)
+    {
+        clock_gettime(LOGX_RATELIMIT_COARSE_CLOCK, &ts);
+        now = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+        if (tat - tol - LOGX_RATELIMIT_COARSE_SLACK_NS > now)
+        {
+            logx_ratelimit_drop(rl, local, tat);
+            return 0;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    now = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+
+    for (;;)
+    {
+        if (tat > now + tol)
+        {
+            logx_ratelimit_drop(rl, local, tat);
+            return 0;
+        }
+
+        next = ((tat > now) ? tat : now) + interval_ns;
+        if (__atomic_compare_exchange_n(&rl->tat_ns, &tat, next, 1, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED))
+            break;
+    }
+
+    *suppressed    = __atomic_exchange_n(&rl->suppressed, 0, __ATOMIC_RELAXED) + local->pending;
+    local->pending = 0;
+    return 1;
+}
+
+#endif /* LOGX_RATELIMIT_H */
@@ -0,0 +1,459 @@
+/**
+ * @file logx_recorder.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Crash flight recorder — slot ring, crash signal handlers and the
+ *        async-signal-safe dump.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* SA_ONSTACK */
+
+#include "logx_recorder.h"
+#include "logx.h"
+#include "logx_common.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief Raw fields of one record. `seq` is 0 while the slot is being written.
+ */
+typedef struct
+{
+    uint64_t seq;     /**< Record number + 1 once the slot is complete. */
+    int64_t sec;      /**< Timestamp, seconds since the epoch. */
+    const char *file; /**< Call-site file (string literal). */
+    const char *func; /**< Call-site function (string literal). */
+    int32_t usec;     /**< Timestamp, microseconds. */
+    int32_t line;     /**< Call-site line. */
+    int32_t level;    /**< Level of the record. */
+    uint32_t len;     /**< Length of the message in `msg`. */
+} recorder_hdr_t;
+
+/**
+ * @brief One fixed-size ring slot.
+ */
+typedef struct
+{
+    recorder_hdr_t hdr;                                            /**< Raw record fields. */
+    char msg[LOGX_RECORDER_SLOT_SIZE - sizeof(recorder_hdr_t)];    /**< Message, truncated. */
+} recorder_slot_t;
+
+/**
+ * @brief Flight recorder of one logger. Everything the dump needs is preallocated.
+ */
+struct logx_recorder_t
+{
+    recorder_slot_t *slots;                      /**< The ring. */
+    size_t count;                                /**< Number of slots. */
+    uint64_t claimed;                            /**< Number of slots handed to writers. */
+    uint64_t head;                               /**< Highest record number published. */
+    char name[64];                               /**< Logger name for the dump header. */
+    char path[LOGX_LOG_FILE_PATH_MAX_LEN_BYTES]; /**< Dump file. */
+};
+
+/* Crash signals and the dispositions they had before the first recorder */
+static const int g_signals[] = {SIGSEGV, SIGABRT, SIGBUS};
+static struct sigaction g_old_actions[ARRAY_SIZE(g_signals)];
+
+/* Registered recorders; the signal handler reads this without locking, counted in
+ * g_handlers_busy, so a recorder is only freed once no handler can still hold it */
+static logx_recorder_t *g_recorders[LOGX_RECORDER_MAX_LOGGERS];
+static pthread_mutex_t g_install_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_installed;
+static int g_dumping;
+static int g_handlers_busy;
+
+/* ── Async-signal-safe formatting ────────────────────────────────────────── */
+
+/**
+ * @brief Append a string to a fixed buffer, truncating at its end.
+ */
+static size_t rec_put_str(char *buf, size_t pos, size_t cap, const char *s, size_t len)
+{
+    if (pos >= cap)
+        return pos;
+    if (len > cap - pos)
+        len = cap - pos;
+    memcpy(buf + pos, s, len);
+    return pos + len;
+}
+
+/**
+ * @brief Append an unsigned decimal, zero-padded to at least `width` digits.
+ */
+static size_t rec_put_uint(char *buf, size_t pos, size_t cap, uint64_t v, int width)
+{
+    char tmp[24];
+    int n = 0;
+
+    do
+    {
+        tmp[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v && n < (int)sizeof(tmp));
+    while (n < width && n < (int)sizeof(tmp))
+        tmp[n++] = '0';
+
+    while (n > 0 && pos < cap)
+        buf[pos++] = tmp[--n];
+    return pos;
+}
+
+/** @brief Append a NUL-terminated string (NULL prints as "?"). */
+static size_t rec_put_cstr(char *buf, size_t pos, size_t cap, const char *s)
+{
+    if (!s)
+        s = "?";
+    return rec_put_str(buf, pos, cap, s, strlen(s));
+}
+
+/**
+ * @brief Append `YYYY-MM-DD HH:MM:SS.uuuuuu` in UTC; `gmtime_r` is not async-signal-safe.
+ */
+static size_t rec_put_time(char *buf, size_t pos, size_t cap, int64_t sec, int32_t usec)
+{
+    int64_t days = sec / 86400;
+    int64_t rem  = sec % 86400;
+
+    if (rem < 0)
+    {
+        rem += 86400;
+        days--;
+    }
+
+    /* Civil date from days since 1970-01-01 (proleptic Gregorian calendar) */
+    int64_t z   = days + 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int64_t doe = z - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp  = (5 * doy + 2) / 153;
+    int64_t d   = doy - (153 * mp + 2) / 5 + 1;
+    int64_t m   = mp < 10 ? mp + 3 : mp - 9;
+    int64_t y   = yoe + era * 400 + (m <= 2);
+
+    pos = rec_put_uint(buf, pos, cap, (uint64_t)y, 4);
+    pos = rec_put_str(buf, pos, cap, "-", 1);
+    pos = rec_put_uint(buf, pos, cap, (uint64_t)m, 2);
+    pos = rec_put_str(buf, pos, cap, "-", 1);
+    pos = rec_put_uint(buf, pos, cap, (uint64_t)d, 2);
+    pos = rec_put_str(buf, pos, cap, " ", 1);
+    pos = rec_put_uint(buf, pos, cap, (uint64_t)(rem / 3600), 2);
+    pos = rec_put_str(buf, pos, cap, ":", 1);
+    pos = rec_put_uint(buf, pos, cap, (uint64_t)(rem / 60 % 60), 2);
+    pos = rec_put_str(buf, pos, cap, ":", 1);
+    pos = rec_put_uint(buf, pos, cap, (uint64_t)(rem % 60), 2);
+    pos = rec_put_str(buf, pos, cap, ".", 1);
+    return rec_put_uint(buf, pos, cap, (uint64_t)usec, 6);
+}
+
+/** @brief write(2) all of `len` bytes, retrying on EINTR. */
+static int rec_write_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return -1;
+        buf += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief Write the ring of one recorder to its file. Async-signal-safe.
+ */
+static logx_errorcodes_t recorder_dump(const logx_recorder_t *rec, const char *reason)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    char line[LOGX_RECORDER_SLOT_SIZE + 256];
+    recorder_slot_t copy;
+    size_t pos   = 0;
+    uint64_t end = __atomic_load_n(&rec->head, __ATOMIC_ACQUIRE);
+    uint64_t beg = end > rec->count ? end - rec->count : 0;
+
+    int fd = open(rec->path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return LOGX_ERR_FILE_OPEN_FAILED;
+
+    pos = rec_put_cstr(line, 0, sizeof(line), "==== LogX flight recorder [");
+    pos = rec_put_cstr(line, pos, sizeof(line), rec->name);
+    pos = rec_put_cstr(line, pos, sizeof(line), "]: ");
+    pos = rec_put_cstr(line, pos, sizeof(line), reason ? reason : "dump");
+    pos = rec_put_cstr(line, pos, sizeof(line), ", last ");
+    pos = rec_put_uint(line, pos, sizeof(line), end - beg, 1);
+    pos = rec_put_cstr(line, pos, sizeof(line), " records ====\n");
+    if (rec_write_all(fd, line, pos) != 0)
+        eErr = LOGX_ERR_FILE_WRITE_FAILED;
+
+    for (uint64_t s = beg; s < end && eErr == LOGX_ERR_SUCCESS; s++)
+    {
+        const recorder_slot_t *slot = &rec->slots[s % rec->count];
+
+        /* Seqlock read: skip a slot that is rewritten while it is copied */
+        if (__atomic_load_n(&slot->hdr.seq, __ATOMIC_ACQUIRE) != s + 1)
+            continue;
+        memcpy(&copy, slot, sizeof(copy));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->hdr.seq, __ATOMIC_RELAXED) != s + 1)
+            continue;
+
+        size_t len = copy.hdr.len < sizeof(copy.msg) ? copy.hdr.len : sizeof(copy.msg);
+
+        pos = rec_put_cstr(line, 0, sizeof(line), "[");
+        pos = rec_put_time(line, pos, sizeof(line), copy.hdr.sec, copy.hdr.usec);
+        pos = rec_put_cstr(line, pos, sizeof(line), " UTC] [");
+        pos = rec_put_cstr(line, pos, sizeof(line), logx_level_to_string(copy.hdr.level));
+        pos = rec_put_cstr(line, pos, sizeof(line), "] (");
+        pos = rec_put_cstr(line, pos, sizeof(line), copy.hdr.file);
+        pos = rec_put_cstr(line, pos, sizeof(line), ":");
+        pos = rec_put_cstr(line, pos, sizeof(line), copy.hdr.func);
+        pos = rec_put_cstr(line, pos, sizeof(line), ":");
+        pos = rec_put_uint(line, pos, sizeof(line), (uint64_t)copy.hdr.line, 1);
+        pos = rec_put_cstr(line, pos, sizeof(line), "): ");
+        pos = rec_put_str(line, pos, sizeof(line) - 1, copy.msg, len);
+        if (pos > sizeof(line) - 1)
+            pos = sizeof(line) - 1;
+        line[pos++] = '\n';
+
+        if (rec_write_all(fd, line, pos) != 0)
+            eErr = LOGX_ERR_FILE_WRITE_FAILED;
+    }
+
+    close(fd);
+    return eErr;
+}
+
+/* ── Crash handler ───────────────────────────────────────────────────────── */
+
+/**
+ * @brief Dump every registered recorder, then hand the signal to its previous disposition.
+ */
+static void recorder_signal_handler(int sig)
+{
+    size_t idx = 0;
+
+    /* A crash while dumping must not dump again */
+    if (!__atomic_exchange_n(&g_dumping, 1, __ATOMIC_SEQ_CST))
+    {
+        const char *reason = sig == SIGSEGV ? "SIGSEGV" : sig == SIGBUS ? "SIGBUS" : "SIGABRT";
+
+        /* Counted before the first slot is read; see logx_recorder_destroy() */
+        __atomic_fetch_add(&g_handlers_busy, 1, __ATOMIC_SEQ_CST);
+        for (size_t i = 0; i < LOGX_RECORDER_MAX_LOGGERS; i++)
+        {
+            logx_recorder_t *rec = __atomic_load_n(&g_recorders[i], __ATOMIC_SEQ_CST);
+            if (rec)
+                recorder_dump(rec, reason);
+        }
+        __atomic_fetch_sub(&g_handlers_busy, 1, __ATOMIC_RELEASE);
+    }
+
+    while (idx < ARRAY_SIZE(g_signals) - 1 && g_signals[idx] != sig)
+        idx++;
+
+    /* The signal is blocked until we return, so the re-raised one hits the old disposition */
+    sigaction(sig, &g_old_actions[idx], NULL);
+    raise(sig);
+}
+
+/**
+ * @brief Install the crash handler once per process. Called with `g_install_lock` held.
+ */
+static void recorder_install_handlers(void)
+{
+    struct sigaction sa;
+
+    if (g_installed)
+        return;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = recorder_signal_handler;
+    sa.sa_flags   = SA_ONSTACK;
+    sigemptyset(&sa.sa_mask);
+
+    for (size_t i = 0; i < ARRAY_SIZE(g_signals); i++)
+        sigaction(g_signals[i], &sa, &g_old_actions[i]);
+
+    g_installed = 1;
+}
+
+/* ── Ring ────────────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Claim the next slot and mark it as being written. Writers on several threads
+ *        claim different slots; `*seq` receives the record number + 1. A writer that is
+ *        lapped by the whole ring may share its slot with a newer one and leave a mixed
+ *        record behind — acceptable for a best-effort crash trace.
+ */
+static recorder_slot_t *recorder_begin(logx_recorder_t *rec, const struct timeval *tv,
+                                       logx_level_t level, const char *file, const char *func,
+                                       int line, uint64_t *seq)
+{
+    uint64_t n            = __atomic_fetch_add(&rec->claimed, 1, __ATOMIC_RELAXED);
+    recorder_slot_t *slot = &rec->slots[n % rec->count];
+
+    *seq = n + 1;
+
+    __atomic_store_n(&slot->hdr.seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot->hdr.sec   = (int64_t)tv->tv_sec;
+    slot->hdr.usec  = (int32_t)tv->tv_usec;
+    slot->hdr.file  = file;
+    slot->hdr.func  = func;
+    slot->hdr.line  = line;
+    slot->hdr.level = (int32_t)level;
+    return slot;
+}
+
+/**
+ * @brief Publish a slot filled by `recorder_begin()`. `head` only moves forward; slots
+ *        below it that are still being written are skipped by the dump.
+ */
+static void recorder_commit(logx_recorder_t *rec, recorder_slot_t *slot, uint64_t seq,
+                            size_t len)
+{
+    uint64_t head = __atomic_load_n(&rec->head, __ATOMIC_RELAXED);
+
+    slot->hdr.len = (uint32_t)(len < sizeof(slot->msg) ? len : sizeof(slot->msg) - 1);
+    __atomic_store_n(&slot->hdr.seq, seq, __ATOMIC_RELEASE);
+    while (head < seq && !__atomic_compare_exchange_n(&rec->head, &head, seq, 1,
+                                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+}
+
+void logx_recorder_push(logx_recorder_t *rec, const struct timeval *tv, logx_level_t level,
+                        const char *file, const char *func, int line, const char *msg)
+{
+    uint64_t seq;
+    recorder_slot_t *slot = recorder_begin(rec, tv, level, file, func, line, &seq);
+    size_t len            = strnlen(msg, sizeof(slot->msg) - 1);
+
+    memcpy(slot->msg, msg, len);
+    recorder_commit(rec, slot, seq, len);
+}
+
+void logx_recorder_vpush(logx_recorder_t *rec, const struct timeval *tv, logx_level_t level,
+                         const char *file, const char *func, int line, const char *fmt,
+                         va_list ap)
+{
+    uint64_t seq;
+    recorder_slot_t *slot = recorder_begin(rec, tv, level, file, func, line, &seq);
+    int n                 = vsnprintf(slot->msg, sizeof(slot->msg), fmt, ap);
+
+    recorder_commit(rec, slot, seq, n > 0 ? (size_t)n : 0);
+}
+
+logx_errorcodes_t logx_recorder_create(logx_t *logger)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_recorder_t *rec   = NULL;
+    size_t i               = 0;
+
+    rec = calloc(1, sizeof(*rec));
+    if (!rec)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    rec->count = (size_t)logger->cfg.recorder_size / sizeof(recorder_slot_t);
+    if (rec->count == 0)
+        rec->count = 1;
+    rec->slots = calloc(rec->count, sizeof(recorder_slot_t));
+    if (!rec->slots)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    snprintf(rec->name, sizeof(rec->name), "%s", logger->cfg.name ? logger->cfg.name : "logx");
+    if (logger->cfg.recorder_path && *logger->cfg.recorder_path)
+        snprintf(rec->path, sizeof(rec->path), "%s", logger->cfg.recorder_path);
+    else
+        snprintf(rec->path, sizeof(rec->path), "%s.crash",
+                 logger->cfg.file_path ? logger->cfg.file_path : "./logx.log");
+
+    pthread_mutex_lock(&g_install_lock);
+    for (i = 0; i < LOGX_RECORDER_MAX_LOGGERS; i++)
+    {
+        if (!g_recorders[i])
+        {
+            __atomic_store_n(&g_recorders[i], rec, __ATOMIC_RELEASE);
+            break;
+        }
+    }
+    if (i < LOGX_RECORDER_MAX_LOGGERS)
+        recorder_install_handlers();
+    pthread_mutex_unlock(&g_install_lock);
+
+    if (i == LOGX_RECORDER_MAX_LOGGERS)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    logger->recorder = rec;
+    rec              = NULL;
+
+END:
+    if (rec)
+    {
+        free(rec->slots);
+        free(rec);
+    }
+    return eErr;
+}
+
+void logx_recorder_destroy(logx_t *logger)
+{
+    logx_recorder_t *rec = logger->recorder;
+
+    if (!rec)
+        return;
+
+    pthread_mutex_lock(&g_install_lock);
+    for (size_t i = 0; i < LOGX_RECORDER_MAX_LOGGERS; i++)
+    {
+        if (g_recorders[i] == rec)
+            __atomic_store_n(&g_recorders[i], NULL, __ATOMIC_SEQ_CST);
+    }
+    pthread_mutex_unlock(&g_install_lock);
+
+    /* A handler that started before the slot was cleared may still be dumping this
+     * recorder; one that starts later cannot find it. A handler interrupting this
+     * thread finishes before we get here. */
+    while (__atomic_load_n(&g_handlers_busy, __ATOMIC_SEQ_CST) != 0)
+    {
+        const struct timespec nap = {.tv_sec = 0, .tv_nsec = 1000000};
+        nanosleep(&nap, NULL);
+    }
+
+    logger->recorder = NULL;
+    free(rec->slots);
+    free(rec);
+}
+
+logx_errorcodes_t logx_recorder_dump(logx_t *logger, const char *reason)
+{
+    /* Sanity check */
+    if (!logger || !logger->recorder)
+        return LOGX_ERR_INVALID_ARG;
+
+    return recorder_dump(logger->recorder, reason);
+}
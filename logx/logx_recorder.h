@@ -0,0 +1,108 @@
+/**
+ * @file logx_recorder.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Crash flight recorder — an always-on in-memory ring of recent records that is
+ *        written to a file when the process crashes or logs FATAL.
+ *
+ * With `recorder_size` > 0, every record at or above `recorder_level` is copied
+ * into a ring of `LOGX_RECORDER_SLOT_SIZE`-byte slots, whether or not any sink
+ * writes it. Only the message itself is formatted; the timestamp, level and
+ * call site are stored raw and turned into text only when the ring is dumped.
+ * A record that no sink wants is formatted straight into its slot. Messages
+ * longer than a slot are truncated.
+ *
+ * The ring is dumped (appended) to `recorder_path` on SIGSEGV, SIGABRT and
+ * SIGBUS, on every `LOGX_FATAL` record, and on `logx_recorder_dump()`. The dump
+ * path only uses `open`, `write` and `close`: no allocation, no stdio and no
+ * locks. Records that are being overwritten while the dump runs are skipped.
+ * After the dump the previous signal disposition is restored and the signal is
+ * raised again, so core dumps and other handlers still work. To cover stack
+ * overflows, give the crashing thread an alternate signal stack (`sigaltstack`).
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_RECORDER_H
+#define LOGX_RECORDER_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+#include <stdarg.h>
+#include <sys/time.h>
+
+/** @brief Size of one flight-recorder slot in bytes, record header included. */
+#ifndef LOGX_RECORDER_SLOT_SIZE
+#define LOGX_RECORDER_SLOT_SIZE 256
+#endif
+
+/** @brief Maximum number of loggers with a flight recorder at the same time. */
+#ifndef LOGX_RECORDER_MAX_LOGGERS
+#define LOGX_RECORDER_MAX_LOGGERS 16
+#endif
+
+/** @brief Opaque flight-recorder state owned by a logger. */
+typedef struct logx_recorder_t logx_recorder_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Append the flight-recorder ring of a logger to its `recorder_path`.
+     *
+     * Async-signal-safe, so it can also be called from an application's own
+     * signal handler.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] reason Short text written into the dump header (may be NULL).
+     * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_INVALID_ARG` if the logger has no
+     *         recorder, `LOGX_ERR_FILE_OPEN_FAILED` or `LOGX_ERR_FILE_WRITE_FAILED`.
+     */
+    logx_errorcodes_t logx_recorder_dump(logx_t *logger, const char *reason);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @brief Internal — allocate the ring of a new logger and install the crash handlers.
+ * @internal
+ * @param[in,out] logger Logger instance with `recorder_size` > 0.
+ * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_NO_MEM`, or `LOGX_ERR_INVALID_ARG` if
+ *         `LOGX_RECORDER_MAX_LOGGERS` recorders already exist.
+ */
+logx_errorcodes_t logx_recorder_create(logx_t *logger);
+
+/**
+ * @brief Internal — unregister and free the ring of a logger, if it has one.
+ * @internal
+ *
+ * Waits for a crash handler that is already dumping to finish before freeing.
+ * @param[in,out] logger Logger instance.
+ */
+void logx_recorder_destroy(logx_t *logger);
+
+/**
+ * @brief Internal — store an already formatted record.
+ * @internal
+ *
+ * Safe to call from several threads at once; no lock is needed.
+ */
+void logx_recorder_push(logx_recorder_t *rec, const struct timeval *tv, logx_level_t level,
+                        const char *file, const char *func, int line, const char *msg);
+
+/**
+ * @brief Internal — format a record straight into the ring.
+ * @internal
+ *
+ * Safe to call from several threads at once; no lock is needed. Consumes `ap`.
+ */
+void logx_recorder_vpush(logx_recorder_t *rec, const struct timeval *tv, logx_level_t level,
+                         const char *file, const char *func, int line, const char *fmt,
+                         va_list ap);
+
+#endif /* LOGX_RECORDER_H */
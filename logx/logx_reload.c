@@ -0,0 +1,496 @@
+/**
+ * @file logx_reload.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Configuration hot reload — snapshot swap and inotify watcher thread.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* pipe2, pthread_setname_np */
+
+#include "logx_reload.h"
+#include "logx.h"
+#include "logx_common.h"
+#include "logx_config.h"
+#include "logx_string_maps.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <syslog.h>
+#include <time.h>
+#include <unistd.h>
+
+/** @brief Quiet period after the last change event before the file is re-read. */
+#define LOGX_RELOAD_DEBOUNCE_MS 100
+
+/**
+ * @brief Configuration fields that log calls read without a lock, in declaration order.
+ *
+ * A reload stores them with `__atomic_store_n()`, like their setters do, and
+ * copies the rest of the configuration around them.
+ */
+#define RELOAD_ATOMIC_FIELDS(X)                                                                    \
+    X(enable_file_logging)                                                                         \
+    X(ts_format)                                                                                   \
+    X(timer_level)                                                                                 \
+    X(timer_resource_usage)                                                                        \
+    X(shed_records_per_sec)                                                                        \
+    X(shed_bytes_per_sec)                                                                          \
+    X(dedup_window_ms)                                                                             \
+    X(recorder_level)                                                                              \
+    X(backfill_level)                                                                              \
+    X(backfill_trigger_level)                                                                      \
+    X(max_message_size)
+
+/**
+ * @brief Watcher thread state for one logger.
+ */
+struct logx_reload_t
+{
+    logx_t *logger;   /**< Logger to reload. */
+    pthread_t thread; /**< Watcher thread. */
+    int inotify_fd;   /**< inotify instance watching the file's directory. */
+    int wake_fd[2];   /**< Pipe used to stop the thread. */
+    char *dir;        /**< Directory containing the file (owned). */
+    const char *base; /**< File name inside `dir` (points into `path`). */
+    char *path;       /**< File being watched (owned). */
+};
+
+/* Reloads are serialised by g_reload_lock, which also guards logger->cfg_path.
+ * Starting and stopping watchers is serialised by g_watch_life; it is never held
+ * while waiting for g_reload_lock, so joining a watcher in the middle of a reload
+ * cannot deadlock. */
+static pthread_mutex_t g_reload_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t g_watch_life  = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Absolute form of `path`, so that a later chdir() does not break reloads.
+ * @return Heap-allocated path, or NULL on allocation failure.
+ */
+static char *reload_canonical_path(const char *path)
+{
+    char *abs = realpath(path, NULL);
+    return abs ? abs : strdup(path);
+}
+
+/**
+ * @brief Open the log file of a configuration that is about to be published.
+ * @return The new handle, or NULL if file logging had to be disabled.
+ */
+static FILE *reload_open_log_file(logx_cfg_t *next)
+{
+    logx_errorcodes_t dir_err = ensure_parent_dir_exists(next->file_path);
+    if (dir_err != LOGX_ERR_SUCCESS)
+        fprintf(stderr, "[LogX] Failed to create path for logfile: %s\n",
+                logx_get_err_string(dir_err));
+
+    FILE *fp = fopen(next->file_path, "a");
+    if (!fp)
+    {
+        fprintf(stderr, "[LogX] Opening %s failed. Disabling file logging...\n",
+                next->file_path);
+        next->enable_file_logging = 0;
+    }
+    return fp;
+}
+
+/**
+ * @brief Publish `next` into the live configuration of a logger.
+ *
+ * Called with the logger lock and the file sink lock held. Log calls read only the
+ * `RELOAD_ATOMIC_FIELDS` without one of them, so those are never written with a
+ * plain store.
+ */
+static void reload_publish_cfg(logx_cfg_t *cfg, const logx_cfg_t *next)
+{
+#define RELOAD_FIELD_SPAN(f) {offsetof(logx_cfg_t, f), sizeof(((logx_cfg_t *)0)->f)},
+    static const struct
+    {
+        size_t off;
+        size_t size;
+    } spans[] = {RELOAD_ATOMIC_FIELDS(RELOAD_FIELD_SPAN)};
+#undef RELOAD_FIELD_SPAN
+    size_t at = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(spans); i++)
+    {
+        memcpy((char *)cfg + at, (const char *)next + at, spans[i].off - at);
+        at = spans[i].off + spans[i].size;
+    }
+    memcpy((char *)cfg + at, (const char *)next + at, sizeof(*cfg) - at);
+
+#define RELOAD_FIELD_STORE(f) __atomic_store_n(&cfg->f, next->f, __ATOMIC_RELAXED);
+    RELOAD_ATOMIC_FIELDS(RELOAD_FIELD_STORE)
+#undef RELOAD_FIELD_STORE
+}
+
+logx_errorcodes_t logx_reload_config(logx_t *logger, const char *path)
+{
+    logx_errorcodes_t eErr       = LOGX_ERR_SUCCESS;
+    logx_cfg_t next              = {0};
+    logx_cfg_t old               = {0};
+    logx_cfg_t shown             = {0};
+    logx_layout_view_t *view     = NULL;
+    logx_layout_view_t *old_view = NULL;
+    FILE *new_fp                 = NULL;
+    FILE *old_fp                 = NULL;
+    logx_direct_t *new_direct    = NULL;
+    logx_direct_t *old_direct    = NULL;
+    const char *src              = NULL;
+    const char *ident            = NULL;
+    int facility                 = 0;
+    int close_syslog             = 0;
+    int reopen                   = 0;
+
+    /* Sanity check */
+    if (!logger)
+        return LOGX_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&g_reload_lock);
+
+    src = path ? path : logger->cfg_path;
+    if (!src)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    /* ── Build the new snapshot without holding any lock ────────────────── */
+    eErr = logx_parse_config_file(src, &next);
+    if (eErr != LOGX_ERR_SUCCESS)
+    {
+        fprintf(stderr, "[LogX] Reloading %s failed: %s. Keeping the current configuration\n",
+                src, logx_get_err_string(eErr));
+        goto END;
+    }
+
+    /* The logger keeps its name, so the new layout only depends on the patterns */
+    eErr = logx_layout_view_new(&view, next.layout_pattern, next.banner_pattern, logger->cfg.name);
+    if (eErr != LOGX_ERR_SUCCESS)
+    {
+        logx_cfg_free_strings(&next);
+        goto END;
+    }
+
+    if (next.use_tty_detection && !isatty(fileno(stdout)))
+        next.enable_colored_logs = 0;
+
+    /* In shared-memory mode the collector keeps writing the file it was started with.
+     * Only reloads change file_path, and they are serialised, so it can be read here. */
+    if (next.enable_file_logging && next.file_path && !logger->shm)
+    {
+        logx_file_sink_lock(logger);
+        reopen = !logger->fp || !logger->cfg.file_path ||
+                 strcmp(logger->cfg.file_path, next.file_path) != 0;
+        logx_file_sink_unlock(logger);
+    }
+    if (reopen)
+        new_fp = reload_open_log_file(&next);
+
+    /* Nothing writes the new file yet, so its O_DIRECT writer can start here as well */
+    if (new_fp && next.file_direct_io)
+        new_direct = logx_direct_open(next.file_path);
+
+    /* ── Publish ─────────────────────────────────────────────────────────── */
+    /* Log calls keep running: the configuration and the file are handed over under
+     * the file sink lock, which is all the file sink writes with */
+    pthread_mutex_lock(&logger->lock);
+    logx_file_sink_lock(logger);
+
+    /* Batched records were rendered for the old file */
+    if (new_fp)
+        logx_file_sink_write_pending(logger);
+
+    old = logger->cfg;
+    reload_publish_cfg(&logger->cfg, &next);
+
+    /* The logger keeps its identity; the strings from the file are freed with `old` */
+    logger->cfg.name                = old.name;
+    logger->cfg.control_socket_path = old.control_socket_path;
+    logger->cfg.recorder_path       = old.recorder_path;
+    logger->cfg.recorder_size       = old.recorder_size;
+    logger->cfg.backfill_size       = old.backfill_size;
+    logger->cfg.shm_name            = old.shm_name;
+    logger->cfg.shm_ring_size       = old.shm_ring_size;
+    logger->cfg.shm_rings           = old.shm_rings;
+    old.name                        = next.name;
+    old.control_socket_path         = next.control_socket_path;
+    old.recorder_path               = next.recorder_path;
+    old.shm_name                    = next.shm_name;
+
+    if (new_fp)
+    {
+        old_fp         = logger->fp;
+        old_direct     = logger->direct;
+        logger->fp     = new_fp;
+        logger->fd     = fileno(new_fp);
+        logger->direct = new_direct;
+        logx_rotation_today(logger->current_date, sizeof(logger->current_date));
+    }
+    else if (old.file_direct_io != logger->cfg.file_direct_io)
+    {
+        /* Same file: the writer has to take over exactly where the other one stopped */
+        logx_direct_stop(logger);
+        logx_direct_start(logger);
+    }
+
+    logx_file_sink_unlock(logger);
+
+    /* Records rendered from here on use the new layout; the old one is freed below */
+    old_view = __atomic_exchange_n(&logger->view, view, __ATOMIC_ACQ_REL);
+
+    /* openlog() keeps the ident pointer, so it is called before `old` is freed */
+    if (logger->cfg.enable_syslog)
+    {
+        ident                 = (logger->cfg.syslog_ident && *logger->cfg.syslog_ident)
+                                    ? logger->cfg.syslog_ident
+                                    : logger->cfg.name;
+        facility              = (int)logger->cfg.syslog_facility;
+        logger->syslog_opened = 1;
+    }
+    else if (logger->syslog_opened)
+    {
+        close_syslog          = 1;
+        logger->syslog_opened = 0;
+    }
+
+    logx_sinks_sync(logger);
+
+    /* Only reloads free these strings, so the copy stays valid after unlocking */
+    if (logger->cfg.print_config)
+        shown = logger->cfg;
+
+    pthread_mutex_unlock(&logger->lock);
+
+    if (ident)
+        openlog(ident, LOG_PID, facility);
+    else if (close_syslog)
+        closelog();
+
+    /* ── Retire the old snapshot ─────────────────────────────────────────── */
+    logx_layout_guard_wait(&logger->view_guard);
+    logx_layout_view_free(old_view);
+
+    /* Nothing writes the old file any more */
+    logx_direct_close(old_direct);
+    if (old_fp)
+    {
+        fflush(old_fp);
+        fclose(old_fp);
+    }
+    logx_cfg_free_strings(&old);
+
+    if (shown.print_config)
+        logx_cfg_print((const logx_cfg_t *)&shown);
+
+    LOGX_INFO(logger, "Configuration reloaded from %s", src);
+
+END:
+    pthread_mutex_unlock(&g_reload_lock);
+    return eErr;
+}
+
+/**
+ * @brief Drain pending inotify events.
+ * @return 1 if any event concerned the watched file, 0 otherwise.
+ */
+static int reload_drain_events(logx_reload_t *w)
+{
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    int hit = 0;
+    ssize_t n;
+
+    while ((n = read(w->inotify_fd, buf, sizeof(buf))) > 0)
+    {
+        for (char *p = buf; p < buf + n;)
+        {
+            const struct inotify_event *ev = (const struct inotify_event *)p;
+            if (ev->len && strcmp(ev->name, w->base) == 0)
+                hit = 1;
+            p += sizeof(*ev) + ev->len;
+        }
+    }
+
+    return hit;
+}
+
+/**
+ * @brief Watcher thread: reload once the file has been quiet for the debounce period.
+ */
+static void *reload_thread(void *arg)
+{
+    logx_reload_t *w = arg;
+    int pending      = 0;
+
+    for (;;)
+    {
+        struct pollfd pfd[2] = {{.fd = w->inotify_fd, .events = POLLIN},
+                                {.fd = w->wake_fd[0], .events = POLLIN}};
+
+        int rc = poll(pfd, 2, pending ? LOGX_RELOAD_DEBOUNCE_MS : -1);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (pfd[1].revents)
+            break;
+
+        if (rc == 0)
+        {
+            pending = 0;
+            logx_reload_config(w->logger, w->path);
+            continue;
+        }
+
+        if (pfd[0].revents & POLLIN)
+            pending |= reload_drain_events(w);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Release a watcher's resources. The thread must not be running.
+ */
+static void reload_free(logx_reload_t *w)
+{
+    if (!w)
+        return;
+    if (w->inotify_fd >= 0)
+        close(w->inotify_fd);
+    if (w->wake_fd[0] >= 0)
+        close(w->wake_fd[0]);
+    if (w->wake_fd[1] >= 0)
+        close(w->wake_fd[1]);
+    free(w->dir);
+    free(w->path);
+    free(w);
+}
+
+/**
+ * @brief Wake and join a logger's watcher thread. Called with `g_watch_life` held.
+ */
+static void reload_stop(logx_t *logger)
+{
+    static const char wake = 1;
+    logx_reload_t *w       = logger->reload;
+
+    if (!w)
+        return;
+
+    if (write(w->wake_fd[1], &wake, 1) < 0)
+        fprintf(stderr, "[LogX] Failed to wake the config watcher: %s\n", strerror(errno));
+
+    pthread_join(w->thread, NULL);
+    reload_free(w);
+    logger->reload = NULL;
+}
+
+logx_errorcodes_t logx_watch_config(logx_t *logger, const char *path)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_reload_t *w       = NULL;
+    char *slash            = NULL;
+
+    /* Sanity check */
+    if (!logger)
+        return LOGX_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&g_watch_life);
+    reload_stop(logger);
+
+    w = calloc(1, sizeof(*w));
+    if (!w)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+    w->logger     = logger;
+    w->inotify_fd = -1;
+    w->wake_fd[0] = -1;
+    w->wake_fd[1] = -1;
+
+    pthread_mutex_lock(&g_reload_lock);
+    if (path || logger->cfg_path)
+    {
+        char *abs = reload_canonical_path(path ? path : logger->cfg_path);
+        if (abs)
+        {
+            free(logger->cfg_path);
+            logger->cfg_path = abs;
+        }
+    }
+    w->path = logger->cfg_path ? strdup(logger->cfg_path) : NULL;
+    pthread_mutex_unlock(&g_reload_lock);
+
+    if (!w->path)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    slash = strrchr(w->path, '/');
+    if (slash)
+    {
+        w->dir  = strndup(w->path, (size_t)(slash - w->path) + (slash == w->path));
+        w->base = slash + 1;
+    }
+    else
+    {
+        w->dir  = strdup(".");
+        w->base = w->path;
+    }
+    if (!w->dir)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    /* Watching the directory also catches editors that save via rename() */
+    w->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (w->inotify_fd < 0 ||
+        inotify_add_watch(w->inotify_fd, w->dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+        pipe2(w->wake_fd, O_CLOEXEC) != 0)
+    {
+        eErr = LOGX_ERR_WATCH_FAILED;
+        goto END;
+    }
+
+    if (pthread_create(&w->thread, NULL, reload_thread, w) != 0)
+    {
+        eErr = LOGX_ERR_THREAD_CREATION_FAILED;
+        goto END;
+    }
+    pthread_setname_np(w->thread, "logx-cfg");
+
+    logger->reload = w;
+    w              = NULL;
+
+END:
+    reload_free(w);
+    pthread_mutex_unlock(&g_watch_life);
+    return eErr;
+}
+
+logx_errorcodes_t logx_unwatch_config(logx_t *logger)
+{
+    /* Sanity check */
+    if (!logger)
+        return LOGX_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&g_watch_life);
+    reload_stop(logger);
+    pthread_mutex_unlock(&g_watch_life);
+
+    return LOGX_ERR_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file logx_reload.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Configuration hot reload — re-read the YAML/JSON config file on demand or
+ *        whenever it changes on disk.
+ *
+ * A reload parses the file into a fresh `logx_cfg_t` through the same
+ * `LOGX_FIELD_TABLE`-driven parsers that `logx_create()` uses, compiles the new
+ * layout and opens the new log file (and `O_DIRECT` writer) if `file_path` changed,
+ * all without a lock. Only then is the result published, while log calls keep
+ * running: the configuration and file handle are handed over under the file sink
+ * lock, and the layout and banner pattern are swapped in as one pointer, so a
+ * record is rendered with either the old or the new ones. The thresholds log calls
+ * check without a lock are stored one by one with atomics, so a call running during
+ * the reload may check some against old and some against new values. The replaced
+ * layout is freed after a grace period in which every log call that may have
+ * loaded it has finished; the old file is closed after that.
+ *
+ * A file that fails to parse is reported on stderr and leaves the running
+ * configuration untouched. `name` and `control_socket_path` identify the logger
+ * and are not changed by a reload.
+ *
+ * With `watch_config` enabled (or after `logx_watch_config()`), a background
+ * thread (`logx-cfg`) watches the file's directory with inotify, so editors that
+ * save through a rename are picked up as well.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_RELOAD_H
+#define LOGX_RELOAD_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+
+/** @brief Opaque config file watcher state owned by a logger. */
+typedef struct logx_reload_t logx_reload_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Re-read a configuration file and apply it to a running logger.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] path   YAML or JSON file to read, or NULL for the file the logger
+     *                   was loaded from (or last told to watch).
+     * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_INVALID_ARG` if there is no file to read,
+     *         or the parser's error code. On error the configuration is unchanged.
+     */
+    logx_errorcodes_t logx_reload_config(logx_t *logger, const char *path);
+
+    /**
+     * @brief Reload the configuration automatically whenever its file changes.
+     *
+     * Replaces any watch already set up for this logger. Changes are debounced so
+     * that a burst of writes results in a single reload.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] path   YAML or JSON file to watch, or NULL for the file the logger
+     *                   was loaded from.
+     * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_INVALID_ARG` if there is no file to watch,
+     *         `LOGX_ERR_WATCH_FAILED` if inotify could not be set up, or
+     *         `LOGX_ERR_THREAD_CREATION_FAILED`.
+     */
+    logx_errorcodes_t logx_watch_config(logx_t *logger, const char *path);
+
+    /**
+     * @brief Stop watching the configuration file. Does nothing if no watch is active.
+     * @param[in] logger Pointer to the logger instance.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` if logger is NULL.
+     */
+    logx_errorcodes_t logx_unwatch_config(logx_t *logger);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGX_RELOAD_H */
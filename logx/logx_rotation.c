@@ -96,8 +96,8 @@ static logx_errorcodes_t compress_file(const char *src_path)
  *
  * @return `LOGX_ERR_SUCCESS` on success, or an error code on failure.
  */
-static logx_errorcodes_t rotate_files(const char *path, int dwMaxBackups, int compress,
-                                      int delay_compress)
+logx_errorcodes_t logx_rotate_files(const char *path, int dwMaxBackups, int compress,
+                                    int delay_compress)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
     int fd                 = -1;
@@ -181,7 +181,7 @@ END:
  * @brief Helper function that performs log rotation on the active log file.
  *
  * Flushes and closes the current log file, rotates the backup files via
- * rotate_files(), then reopens the log file for appending. The file is
+ * logx_rotate_files(), then reopens the log file for appending. The file is
  * exclusively locked for the duration of the operation to prevent concurrent
  * writes during rotation.
  *
@@ -220,11 +220,20 @@ static logx_errorcodes_t process_log_rotation(logx_t *ptLogger)
         fflush(ptLogger->fp);
     }
 
+    /* write out the O_DIRECT buffers and trim the file before it is renamed */
+    logx_direct_stop(ptLogger);
+
     /* perform log rotation */
-    if ((eErr = rotate_files(ptLogger->cfg.file_path, ptLogger->cfg.rotate.max_backups,
-                             ptLogger->cfg.rotate.compress,
-                             ptLogger->cfg.rotate.delay_compress)) != LOGX_ERR_SUCCESS)
+    if ((eErr = logx_rotate_files(ptLogger->cfg.file_path, ptLogger->cfg.rotate.max_backups,
+                                  ptLogger->cfg.rotate.compress,
+                                  ptLogger->cfg.rotate.delay_compress)) != LOGX_ERR_SUCCESS)
     {
+        /* keep writing to the current file, in O_DIRECT mode if it was on */
+        logx_direct_start(ptLogger);
+        if (ptLogger->fd >= 0)
+        {
+            unlock_flock(ptLogger->fd);
+        }
         goto END;
     }
 
@@ -239,10 +248,12 @@ static logx_errorcodes_t process_log_rotation(logx_t *ptLogger)
     if (ptLogger->fp)
     {
         ptLogger->fd = fileno(ptLogger->fp);
+        logx_direct_start(ptLogger);
     }
     else
     {
-        ptLogger->cfg.enable_file_logging = 0; /* disable file logging if we can't open file */
+        /* disable file logging if we can't open file */
+        __atomic_store_n(&ptLogger->cfg.enable_file_logging, 0, __ATOMIC_RELAXED);
         unlock_flock(ptLogger->fd);
         ptLogger->fd = -1;
         eErr         = LOGX_ERR_FILE_OPEN_FAILED;
@@ -259,6 +270,22 @@ END:
     return eErr;
 }
 
+/**
+ * @brief Write today's local date as `YYYY-MM-DD`
+ *
+ * @param[out] buf - Destination
+ * @param[in] size - Size of buf in bytes
+ */
+void logx_rotation_today(char *buf, size_t size)
+{
+    time_t t = time(NULL);
+    struct tm tm;
+
+    localtime_r(&t, &tm);
+    snprintf(buf, size, "%04u-%02u-%02u", (unsigned)(tm.tm_year + 1900) % 10000U,
+             (unsigned)(tm.tm_mon + 1) % 100U, (unsigned)tm.tm_mday % 100U);
+}
+
 /**
  * @brief Function that checks if log rotation is needed and performs log rotation
  *
@@ -268,9 +295,7 @@ END:
 logx_errorcodes_t check_and_rotate_log(logx_t *ptLogger)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
-    time_t t               = time(NULL);
-    struct tm tm;
-    char today[16];
+    char today[sizeof(ptLogger->current_date)];
     struct stat st;
 
     if (!ptLogger || !ptLogger->cfg.enable_file_logging || !ptLogger->cfg.file_path)
@@ -281,9 +306,7 @@ logx_errorcodes_t check_and_rotate_log(logx_t *ptLogger)
 
     if (ptLogger->cfg.rotate.type == LOGX_ROTATE_BY_DATE)
     {
-        localtime_r(&t, &tm);
-        snprintf(today, sizeof(today), "%04d-%02d-%02d", tm.tm_year + 1900, tm.tm_mon + 1,
-                 tm.tm_mday);
+        logx_rotation_today(today, sizeof(today));
         if (strcmp(today, ptLogger->current_date) != 0)
         {
             if ((eErr = process_log_rotation(ptLogger)) != LOGX_ERR_SUCCESS)
@@ -292,12 +315,24 @@ logx_errorcodes_t check_and_rotate_log(logx_t *ptLogger)
             }
 
             /* update current date */
-            strncpy(ptLogger->current_date, today, sizeof(ptLogger->current_date));
+            memcpy(ptLogger->current_date, today, sizeof(ptLogger->current_date));
         }
     }
     else if (ptLogger->cfg.rotate.type == LOGX_ROTATE_BY_SIZE)
     {
-        if (ptLogger->fd >= 0)
+        if (ptLogger->direct)
+        {
+            /* the file on disk lags behind the O_DIRECT buffers */
+            if ((size_t)logx_direct_size(ptLogger->direct) >=
+                (long unsigned int)CONVERT_MB_TO_BYTES(ptLogger->cfg.rotate.size_mb))
+            {
+                if ((eErr = process_log_rotation(ptLogger)) != LOGX_ERR_SUCCESS)
+                {
+                    goto END;
+                }
+            }
+        }
+        else if (ptLogger->fd >= 0)
         {
             if (fstat(ptLogger->fd, &st) == 0)
             {
@@ -460,8 +495,19 @@ logx_errorcodes_t logx_rotate_now(logx_t *logger)
     }
 
     pthread_mutex_lock(&logger->lock);
-    if (logger->cfg.enable_file_logging && logger->cfg.file_path)
+    pthread_rwlock_rdlock(&logger->sinks.lock);
+    if (logger->shm)
+    {
+        /* The collector process owns the file; it rotates after what is already queued */
+        logx_sinks_flush_locked(logger);
+        logx_shm_request_rotation(logger->shm);
+    }
+    else if (logger->cfg.enable_file_logging && logger->cfg.file_path)
     {
+        /* Batched records belong to the file being rotated out */
+        logx_sinks_flush_locked(logger);
+        logx_file_sink_lock(logger);
+
         if (logger->fd >= 0)
         {
             exclusive_flock(logger->fd);
@@ -472,8 +518,10 @@ logx_errorcodes_t logx_rotate_now(logx_t *logger)
             fflush(logger->fp);
         }
 
-        r = rotate_files(logger->cfg.file_path, logger->cfg.rotate.max_backups,
-                         logger->cfg.rotate.compress, logger->cfg.rotate.delay_compress);
+        logx_direct_stop(logger);
+
+        r = logx_rotate_files(logger->cfg.file_path, logger->cfg.rotate.max_backups,
+                              logger->cfg.rotate.compress, logger->cfg.rotate.delay_compress);
 
         if (logger->fp)
         {
@@ -485,13 +533,16 @@ logx_errorcodes_t logx_rotate_now(logx_t *logger)
         if (logger->fp)
         {
             logger->fd = fileno(logger->fp);
+            logx_direct_start(logger);
         }
 
         if (logger->fd >= 0)
         {
             unlock_flock(logger->fd);
         }
+        logx_file_sink_unlock(logger);
     }
+    pthread_rwlock_unlock(&logger->sinks.lock);
     pthread_mutex_unlock(&logger->lock);
     return r;
 }
\ No newline at end of file
@@ -118,6 +118,30 @@ extern "C"
      */
     logx_errorcodes_t check_and_rotate_log(logx_t *ptLogger);
 
+    /**
+     * @brief Internal — write today's local date as `YYYY-MM-DD`, as date rotation compares it.
+     * @internal
+     *
+     * @param[out] buf  Destination, e.g. `logx_t::current_date`.
+     * @param[in]  size Size of `buf` in bytes.
+     */
+    void logx_rotation_today(char *buf, size_t size);
+
+    /**
+     * @brief Internal — shift the backups of `path` and move the active file to `path.1`.
+     * @internal
+     *
+     * Used by the file and mmap sinks. Does not reopen anything.
+     *
+     * @param[in] path           Path to the active log file.
+     * @param[in] dwMaxBackups   Maximum backup files to retain (0 = truncate, no backup).
+     * @param[in] compress       1 = compress backups with gzip.
+     * @param[in] delay_compress 1 = defer compression of the newest backup by one rotation.
+     * @return `LOGX_ERR_SUCCESS` on success, or an error code on failure.
+     */
+    logx_errorcodes_t logx_rotate_files(const char *path, int dwMaxBackups, int compress,
+                                        int delay_compress);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,96 @@
+/**
+ * @file logx_sample.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Per-call-site sampling used by the `LOGX_*_SAMPLE` and `LOGX_*_PROB` macros.
+ *
+ * All state is thread-local: each call site keeps its own 1-in-N counter per
+ * thread, and each thread has its own xorshift64* generator for probabilistic
+ * sampling. A rejected call costs one increment or one PRNG step and touches no
+ * shared cache line.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_SAMPLE_H
+#define LOGX_SAMPLE_H
+
+#include <stdint.h>
+#include <time.h>
+
+/** @brief Thread-local storage specifier usable from both C and C++ call sites. */
+#ifdef __cplusplus
+#define LOGX_THREAD_LOCAL thread_local
+#else
+#define LOGX_THREAD_LOCAL _Thread_local
+#endif
+
+/**
+ * @brief 1-in-N decision for a call-site counter.
+ * @internal
+ *
+ * The first call on each thread is kept, then every `n`-th one after it.
+ *
+ * @param[in,out] counter Thread-local per-call-site counter, zero-initialised.
+ * @param[in]     n       Keep one call out of `n`. 0 and 1 keep every call.
+ * @return 1 if the message should be logged, 0 if it should be skipped.
+ */
+static inline int logx_sample_every(uint32_t *counter, uint32_t n)
+{
+    uint32_t c = *counter;
+
+    *counter = (c + 1 >= n) ? 0 : c + 1;
+    return c == 0;
+}
+
+/**
+ * @brief Next value of the calling thread's xorshift64* generator.
+ * @internal
+ *
+ * Seeded lazily from the clock and the address of the thread's state, so
+ * threads draw independent sequences.
+ *
+ * @return 64 pseudo-random bits.
+ */
+static inline uint64_t logx_sample_rand(void)
+{
+    static LOGX_THREAD_LOCAL uint64_t state = 0;
+    uint64_t x                              = state;
+
+    if (!x)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        x = ((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec) ^
+            ((uint64_t)(uintptr_t)&state * 0x9e3779b97f4a7c15ULL);
+        if (!x)
+            x = 0x9e3779b97f4a7c15ULL;
+    }
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    state = x;
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+/**
+ * @brief Bernoulli decision with probability `p`.
+ * @internal
+ *
+ * @param[in] p Probability of keeping the call; clamped to [0, 1].
+ * @return 1 if the message should be logged, 0 if it should be skipped.
+ */
+static inline int logx_sample_prob(double p)
+{
+    if (p >= 1.0)
+        return 1;
+    if (!(p > 0.0))
+        return 0;
+    /* Top 53 bits as a uniform double in [0, 1) */
+    return (double)(logx_sample_rand() >> 11) * (1.0 / 9007199254740992.0) < p;
+}
+
+#endif /* LOGX_SAMPLE_H */
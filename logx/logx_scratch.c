@@ -0,0 +1,141 @@
+/**
+ * @file logx_scratch.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Per-thread scratch arenas.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "logx_scratch.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Arenas of one thread. Freed by the key destructor when the thread exits.
+ */
+typedef struct
+{
+    logx_scratch_t arenas[LOGX_SCRATCH_DEPTH]; /**< One arena per nesting level. */
+    int depth;                                 /**< Log calls in progress on the thread. */
+} scratch_thread_t;
+
+static pthread_key_t g_scratch_key;
+static pthread_once_t g_scratch_once = PTHREAD_ONCE_INIT;
+static _Thread_local scratch_thread_t *tls_scratch;
+
+/**
+ * @brief Free every buffer of an arena, or only those larger than `keep` bytes.
+ */
+static void scratch_trim(logx_scratch_t *s, size_t keep)
+{
+    logx_scratch_buf_t *bufs[] = {&s->payload, &s->prefix, &s->location, &s->border};
+
+    for (size_t i = 0; i < sizeof(bufs) / sizeof(bufs[0]); i++)
+    {
+        if (bufs[i]->cap > keep)
+        {
+            free(bufs[i]->data);
+            bufs[i]->data = NULL;
+            bufs[i]->cap  = 0;
+        }
+    }
+
+    for (size_t i = 0; i < LOGX_SINK_FORMAT_COUNT; i++)
+    {
+        if (s->render[i].cap > keep)
+        {
+            free(s->render[i].data);
+            s->render[i].data = NULL;
+            s->render[i].cap  = 0;
+        }
+    }
+}
+
+/** @brief Key destructor — free the exiting thread's arenas. */
+static void scratch_thread_free(void *arg)
+{
+    scratch_thread_t *t = arg;
+
+    for (int i = 0; i < LOGX_SCRATCH_DEPTH; i++)
+        scratch_trim(&t->arenas[i], 0);
+    free(t);
+
+    /* A destructor of another key may still log; it starts over with fresh arenas */
+    tls_scratch = NULL;
+}
+
+/** @brief Create the key that frees a thread's arenas when the thread exits. */
+static void scratch_key_init(void)
+{
+    pthread_key_create(&g_scratch_key, scratch_thread_free);
+}
+
+logx_scratch_t *logx_scratch_acquire(void)
+{
+    logx_scratch_t *s = NULL;
+
+    if (!tls_scratch)
+    {
+        pthread_once(&g_scratch_once, scratch_key_init);
+        tls_scratch = calloc(1, sizeof(*tls_scratch));
+        if (!tls_scratch)
+            return NULL;
+        pthread_setspecific(g_scratch_key, tls_scratch);
+    }
+
+    if (tls_scratch->depth < LOGX_SCRATCH_DEPTH)
+    {
+        s = &tls_scratch->arenas[tls_scratch->depth];
+    }
+    else
+    {
+        s = calloc(1, sizeof(*s));
+        if (!s)
+            return NULL;
+        s->heap = 1;
+    }
+
+    tls_scratch->depth++;
+    return s;
+}
+
+void logx_scratch_release(logx_scratch_t *s)
+{
+    if (!s)
+        return;
+
+    if (tls_scratch)
+        tls_scratch->depth--;
+
+    if (s->heap)
+    {
+        scratch_trim(s, 0);
+        free(s);
+        return;
+    }
+
+    scratch_trim(s, LOGX_SCRATCH_KEEP_SIZE);
+}
+
+char *logx_scratch_reserve(logx_scratch_buf_t *b, size_t size)
+{
+    size_t cap = b->cap ? b->cap : LOGX_SCRATCH_MIN_SIZE;
+    char *p    = NULL;
+
+    if (size <= b->cap)
+        return b->data;
+
+    while (cap < size)
+        cap = (cap > SIZE_MAX / 2) ? size : cap * 2;
+
+    p = realloc(b->data, cap);
+    if (!p)
+        return NULL;
+
+    b->data = p;
+    b->cap  = cap;
+    return p;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file logx_scratch.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Per-thread scratch arenas — the reusable buffers a log call formats and
+ *        renders its record into.
+ *
+ * Each thread owns a small stack of arenas, allocated on its first log call and
+ * freed when it exits. An arena holds one growable buffer per purpose (payload,
+ * prefix, banner border, one rendered record per sink format). Buffers start
+ * small and grow to the largest record the thread has produced, so a log call
+ * keeps its stack frame small and only touches the bytes the record needs.
+ * Buffers that grew past `LOGX_SCRATCH_KEEP_SIZE` are released again when the
+ * call ends, so one huge record does not pin memory for the thread's lifetime.
+ *
+ * A log call that runs inside another one on the same thread (a sink callback
+ * logging through a second logger) takes the next arena; beyond
+ * `LOGX_SCRATCH_DEPTH` levels, a temporary arena is allocated for the call.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_SCRATCH_H
+#define LOGX_SCRATCH_H
+
+#include "logx_sink.h"
+#include <stddef.h>
+
+/** @brief Smallest `max_message_size` in bytes; smaller values are raised to it. */
+#ifndef LOGX_MESSAGE_MIN_SIZE
+#define LOGX_MESSAGE_MIN_SIZE 256
+#endif
+
+/** @brief Initial capacity of a scratch buffer in bytes. */
+#ifndef LOGX_SCRATCH_MIN_SIZE
+#define LOGX_SCRATCH_MIN_SIZE 256
+#endif
+
+/** @brief Scratch buffers larger than this are freed at the end of the log call. */
+#ifndef LOGX_SCRATCH_KEEP_SIZE
+#define LOGX_SCRATCH_KEEP_SIZE (64 * 1024)
+#endif
+
+/** @brief Number of nested log calls per thread served from the thread's own arenas. */
+#ifndef LOGX_SCRATCH_DEPTH
+#define LOGX_SCRATCH_DEPTH 2
+#endif
+
+/**
+ * @brief A growable buffer inside a scratch arena.
+ */
+typedef struct
+{
+    char *data; /**< Storage, or NULL until first reserved. */
+    size_t cap; /**< Capacity of `data` in bytes. */
+} logx_scratch_buf_t;
+
+/**
+ * @brief The buffers one log call works with.
+ */
+typedef struct
+{
+    logx_scratch_buf_t payload;                        /**< Formatted message text. */
+    logx_scratch_buf_t prefix;                         /**< Rendered layout. */
+    logx_scratch_buf_t location;                       /**< `file:func:line` without a site. */
+    logx_scratch_buf_t border;                         /**< Banner border. */
+    logx_scratch_buf_t render[LOGX_SINK_FORMAT_COUNT]; /**< Rendered record per format. */
+    int heap;                                          /**< 1 if allocated for one call. */
+} logx_scratch_t;
+
+/**
+ * @brief Internal — take the calling thread's arena for one log call.
+ * @internal
+ *
+ * Every successful call must be paired with `logx_scratch_release()`.
+ *
+ * @return The arena, or NULL if it cannot be allocated.
+ */
+logx_scratch_t *logx_scratch_acquire(void);
+
+/**
+ * @brief Internal — hand the arena back at the end of the log call.
+ * @internal
+ * @param[in,out] s Arena returned by `logx_scratch_acquire()`.
+ */
+void logx_scratch_release(logx_scratch_t *s);
+
+/**
+ * @brief Internal — make sure a scratch buffer holds at least `size` bytes.
+ * @internal
+ *
+ * The contents are kept when the buffer grows.
+ *
+ * @param[in,out] b    Buffer.
+ * @param[in]     size Bytes needed.
+ * @return The buffer's storage, or NULL if it cannot grow (the old storage is kept).
+ */
+char *logx_scratch_reserve(logx_scratch_buf_t *b, size_t size);
+
+#endif /* LOGX_SCRATCH_H */
@@ -0,0 +1,269 @@
+/**
+ * @file logx_shed.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Adaptive load shedding — lock-free volume accounting and step control.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* CLOCK_MONOTONIC_COARSE */
+
+#include "logx_shed.h"
+#include "logx.h"
+#include "logx_common.h"
+#include "logx_errorcodes.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+/** @brief Pending per-thread counts are folded into the logger after this many records. */
+#define LOGX_SHED_FLUSH_EVERY 64
+
+/** @brief Highest shedding step. */
+#define LOGX_SHED_MAX_STEP 2
+
+/**
+ * @brief Per-thread accounting batch for the logger this thread logged to most recently.
+ *
+ * Counts are only ever flushed into `owner` while a call on that very logger is in
+ * progress, so a stale `owner` pointer is never dereferenced.
+ */
+typedef struct
+{
+    logx_t *owner;    /**< Logger the pending counts belong to. */
+    uint64_t tick;    /**< Coarse clock tick (~134 ms) of the last flush. */
+    uint32_t offered; /**< Pending offered records. */
+    uint32_t records; /**< Pending written records. */
+    uint32_t shed;    /**< Pending shed records. */
+    uint64_t bytes;   /**< Pending written bytes. */
+} logx_shed_tls_t;
+
+static _Thread_local logx_shed_tls_t tls_shed;
+
+/**
+ * @brief Lowest level still written at a given shedding step.
+ * @param[in] step Shedding step.
+ * @return Level floor for that step.
+ */
+static logx_level_t shed_floor(int step)
+{
+    switch (step)
+    {
+        case 0:
+            return LOGX_LEVEL_TRACE;
+        case 1:
+            return LOGX_LEVEL_BANNER;
+        default:
+            return LOGX_LEVEL_WARN;
+    }
+}
+
+/**
+ * @brief Fold this thread's pending counts into the logger's atomic counters.
+ * @param[in,out] logger Logger the counts belong to (must be `tls_shed.owner`).
+ */
+static void shed_flush(logx_t *logger)
+{
+    logx_shed_t *s = &logger->shed;
+
+    if (tls_shed.offered)
+        __atomic_fetch_add(&s->offered, tls_shed.offered, __ATOMIC_RELAXED);
+    if (tls_shed.records)
+        __atomic_fetch_add(&s->records, tls_shed.records, __ATOMIC_RELAXED);
+    if (tls_shed.bytes)
+        __atomic_fetch_add(&s->bytes, tls_shed.bytes, __ATOMIC_RELAXED);
+    if (tls_shed.shed)
+        __atomic_fetch_add(&s->shed, tls_shed.shed, __ATOMIC_RELAXED);
+
+    tls_shed.offered = 0;
+    tls_shed.records = 0;
+    tls_shed.bytes   = 0;
+    tls_shed.shed    = 0;
+}
+
+/**
+ * @brief Close an accounting window and move the shedding step up or down.
+ *
+ * Runs on exactly one thread per window (the one that won the window CAS).
+ *
+ * @param[in,out] logger Logger instance.
+ * @param[in]     span   Length of the closed window in seconds (>= 1).
+ * @param[out]    report Filled in if the step changed.
+ */
+static void shed_evaluate(logx_t *logger, uint64_t span, logx_shed_report_t *report)
+{
+    logx_shed_t *s   = &logger->shed;
+    int max_records  = __atomic_load_n(&logger->cfg.shed_records_per_sec, __ATOMIC_RELAXED);
+    int max_bytes    = __atomic_load_n(&logger->cfg.shed_bytes_per_sec, __ATOMIC_RELAXED);
+    uint64_t offered = __atomic_exchange_n(&s->offered, 0, __ATOMIC_RELAXED);
+    uint64_t records = __atomic_exchange_n(&s->records, 0, __ATOMIC_RELAXED);
+    uint64_t bytes   = __atomic_exchange_n(&s->bytes, 0, __ATOMIC_RELAXED);
+    uint64_t shed    = __atomic_exchange_n(&s->shed, 0, __ATOMIC_RELAXED);
+
+    /* Only written records have a known size; estimate the offered bytes from them */
+    uint64_t rec_rate  = offered / span;
+    uint64_t avg_bytes = records ? bytes / records : 0;
+    uint64_t byte_rate = rec_rate * avg_bytes;
+
+    int over  = (max_records > 0 && rec_rate > (uint64_t)max_records) ||
+               (max_bytes > 0 && byte_rate > (uint64_t)max_bytes);
+    int under = (max_records <= 0 || rec_rate * 2 < (uint64_t)max_records) &&
+                (max_bytes <= 0 || byte_rate * 2 < (uint64_t)max_bytes);
+
+    int step                = __atomic_load_n(&s->step, __ATOMIC_RELAXED);
+    int new_step            = step;
+    logx_shed_event_t event = LOGX_SHED_STEADY;
+    uint64_t shed_total     = __atomic_add_fetch(&s->shed_total, shed, __ATOMIC_RELAXED);
+
+    if (over && step < LOGX_SHED_MAX_STEP)
+    {
+        new_step = step + 1;
+        event    = step ? LOGX_SHED_ESCALATED : LOGX_SHED_STARTED;
+    }
+    else if (under && step > 0)
+    {
+        new_step = step - 1;
+        event    = new_step ? LOGX_SHED_RELAXED : LOGX_SHED_ENDED;
+    }
+
+    if (event == LOGX_SHED_STEADY)
+        return;
+
+    if (event == LOGX_SHED_STARTED || event == LOGX_SHED_ENDED)
+        __atomic_store_n(&s->shed_total, 0, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&s->step, new_step, __ATOMIC_RELAXED);
+
+    report->event           = event;
+    report->step            = new_step;
+    report->records_per_sec = rec_rate;
+    report->bytes_per_sec   = byte_rate;
+    report->shed_total      = shed_total;
+    report->budget_records  = max_records;
+    report->budget_bytes    = max_bytes;
+}
+
+int logx_shed_admit(logx_t *logger, logx_level_t level, logx_shed_report_t *report)
+{
+    struct timespec now;
+    int admit = 1;
+
+    report->event = LOGX_SHED_STEADY;
+
+    if (__atomic_load_n(&logger->cfg.shed_records_per_sec, __ATOMIC_RELAXED) <= 0 &&
+        __atomic_load_n(&logger->cfg.shed_bytes_per_sec, __ATOMIC_RELAXED) <= 0)
+        return 1;
+
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+    uint64_t now_ns = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+    uint64_t sec    = (uint64_t)now.tv_sec;
+    uint64_t tick   = now_ns >> 27;
+
+    if (tls_shed.owner != logger)
+    {
+        memset(&tls_shed, 0, sizeof(tls_shed));
+        tls_shed.owner = logger;
+        tls_shed.tick  = tick;
+    }
+
+    int step = __atomic_load_n(&logger->shed.step, __ATOMIC_RELAXED);
+    if (step && level < shed_floor(step))
+        admit = 0;
+
+    tls_shed.offered++;
+    if (admit)
+        tls_shed.records++;
+    else
+        tls_shed.shed++;
+
+    if (tls_shed.offered >= LOGX_SHED_FLUSH_EVERY || tls_shed.tick != tick)
+    {
+        shed_flush(logger);
+        tls_shed.tick = tick;
+    }
+
+    /* Window rollover — exactly one thread wins the CAS and evaluates */
+    uint64_t window = __atomic_load_n(&logger->shed.window, __ATOMIC_RELAXED);
+    if (sec > window && __atomic_compare_exchange_n(&logger->shed.window, &window, sec, 0,
+                                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+        if (window)
+            shed_evaluate(logger, sec - window, report);
+    }
+
+    return admit;
+}
+
+void logx_shed_account_bytes(logx_t *logger, size_t bytes)
+{
+    if (tls_shed.owner == logger)
+        tls_shed.bytes += bytes;
+}
+
+void logx_shed_report(logx_t *logger, const logx_shed_report_t *report)
+{
+    static const char *const shed_what[] = {"nothing", "TRACE/DEBUG", "TRACE/DEBUG/BANNER/INFO"};
+
+    if (!report || report->event == LOGX_SHED_STEADY)
+        return;
+
+    switch (report->event)
+    {
+        case LOGX_SHED_STARTED:
+        case LOGX_SHED_ESCALATED:
+            LOGX_WARN(logger,
+                      "Load shedding %s: %llu records/s, ~%llu bytes/s over budget (%d records/s, "
+                      "%d bytes/s) - dropping %s",
+                      report->event == LOGX_SHED_STARTED ? "started" : "escalated",
+                      (unsigned long long)report->records_per_sec,
+                      (unsigned long long)report->bytes_per_sec, report->budget_records,
+                      report->budget_bytes, shed_what[report->step]);
+            break;
+        case LOGX_SHED_RELAXED:
+            LOGX_WARN(logger,
+                      "Load shedding relaxed: %llu records/s, ~%llu bytes/s - dropping %s",
+                      (unsigned long long)report->records_per_sec,
+                      (unsigned long long)report->bytes_per_sec, shed_what[report->step]);
+            break;
+        case LOGX_SHED_ENDED:
+            LOGX_WARN(logger, "Load shedding ended: %llu records dropped",
+                      (unsigned long long)report->shed_total);
+            break;
+        default:
+            break;
+    }
+}
+
+logx_errorcodes_t logx_set_shed_budget(logx_t *logger, int records_per_sec, int bytes_per_sec)
+{
+    logx_errorcodes_t eErr    = LOGX_ERR_SUCCESS;
+    logx_shed_report_t report = {0};
+
+    /* Sanity check */
+    if (!logger || records_per_sec < 0 || bytes_per_sec < 0)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.shed_records_per_sec, records_per_sec, __ATOMIC_RELAXED);
+    __atomic_store_n(&logger->cfg.shed_bytes_per_sec, bytes_per_sec, __ATOMIC_RELAXED);
+
+    /* Turning the budget off ends any shedding in progress */
+    if (!records_per_sec && !bytes_per_sec &&
+        __atomic_exchange_n(&logger->shed.step, 0, __ATOMIC_RELAXED))
+    {
+        report.event      = LOGX_SHED_ENDED;
+        report.shed_total = __atomic_exchange_n(&logger->shed.shed_total, 0, __ATOMIC_RELAXED) +
+                            __atomic_exchange_n(&logger->shed.shed, 0, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&logger->lock);
+
+    logx_shed_report(logger, &report);
+
+END:
+    return eErr;
+}
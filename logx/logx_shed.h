@@ -0,0 +1,130 @@
+/**
+ * @file logx_shed.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Adaptive load shedding — temporarily raise the effective log level when a
+ *        logger exceeds its records/s or bytes/s budget.
+ *
+ * Volume is counted per thread in thread-local storage and folded into per-logger
+ * atomic counters in batches, so the accounting never takes a lock. Once per
+ * second one thread closes the window and decides whether to shed more, less, or
+ * stop shedding:
+ *
+ *  - step 0: nothing shed
+ *  - step 1: TRACE and DEBUG are dropped
+ *  - step 2: BANNER and INFO are dropped as well (WARN and above always pass)
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_SHED_H
+#define LOGX_SHED_H
+
+#include "logx_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Per-logger load-shedding state embedded in `logx_t`.
+ *
+ * All fields are accessed with `__atomic` builtins.
+ */
+typedef struct
+{
+    uint64_t window;     /**< Start of the current accounting window (monotonic seconds). */
+    uint64_t offered;    /**< Records that passed the configured levels in this window. */
+    uint64_t records;    /**< Records actually written in this window. */
+    uint64_t bytes;      /**< Bytes actually written in this window. */
+    uint64_t shed;       /**< Records dropped by shedding in this window. */
+    uint64_t shed_total; /**< Records dropped since shedding last started. */
+    int step;            /**< Current shedding step (0 = off). */
+} logx_shed_t;
+
+/**
+ * @brief Shedding state change reported by `logx_shed_admit()`.
+ * @internal
+ */
+typedef enum
+{
+    LOGX_SHED_STEADY = 0, /**< No change. */
+    LOGX_SHED_STARTED,    /**< Shedding switched on. */
+    LOGX_SHED_ESCALATED,  /**< Shedding moved to a higher step. */
+    LOGX_SHED_RELAXED,    /**< Shedding moved to a lower, non-zero step. */
+    LOGX_SHED_ENDED       /**< Shedding switched off. */
+} logx_shed_event_t;
+
+/**
+ * @brief Snapshot of the numbers behind a shedding state change, for reporting.
+ * @internal
+ */
+typedef struct
+{
+    logx_shed_event_t event;  /**< What happened. */
+    int step;                 /**< Step after the change. */
+    uint64_t records_per_sec; /**< Offered records/s in the window that triggered it. */
+    uint64_t bytes_per_sec;   /**< Estimated offered bytes/s in that window. */
+    uint64_t shed_total;      /**< Records dropped during the episode (on `LOGX_SHED_ENDED`). */
+    int budget_records;       /**< Records/s budget in effect (0 = none). */
+    int budget_bytes;         /**< Bytes/s budget in effect (0 = none). */
+} logx_shed_report_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Set the per-logger volume budget that triggers load shedding.
+     *
+     * When either budget is exceeded over a one-second window, the effective log
+     * level is raised one step (TRACE/DEBUG shed first, then BANNER/INFO). It is
+     * lowered again once offered volume falls below half of the budget. A WARN
+     * record is logged when shedding starts, changes step and ends.
+     *
+     * @param[in] logger          Pointer to the logger instance.
+     * @param[in] records_per_sec Maximum records per second, or 0 for no record budget.
+     * @param[in] bytes_per_sec   Maximum bytes per second, or 0 for no byte budget.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_set_shed_budget(logx_t *logger, int records_per_sec, int bytes_per_sec);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @brief Internal — account one record and decide whether it is shed.
+ * @internal
+ *
+ * Call for every record that passed the configured levels, before formatting.
+ *
+ * @param[in,out] logger Logger instance.
+ * @param[in]     level  Level of the record.
+ * @param[out]    report Filled in when the shedding state changed; `event` is
+ *                       `LOGX_SHED_STEADY` otherwise. The caller should log it once
+ *                       it no longer holds the logger lock.
+ * @return 1 if the record should be written, 0 if it is shed.
+ */
+int logx_shed_admit(logx_t *logger, logx_level_t level, logx_shed_report_t *report);
+
+/**
+ * @brief Internal — account the bytes of a record that was written.
+ * @internal
+ *
+ * @param[in,out] logger Logger instance.
+ * @param[in]     bytes  Size of the rendered record in bytes.
+ */
+void logx_shed_account_bytes(logx_t *logger, size_t bytes);
+
+/**
+ * @brief Internal — log a WARN record describing a shedding state change.
+ * @internal
+ *
+ * @param[in] logger Logger instance. Must not be locked by the caller.
+ * @param[in] report Report returned by `logx_shed_admit()`.
+ */
+void logx_shed_report(logx_t *logger, const logx_shed_report_t *report);
+
+#endif /* LOGX_SHED_H */
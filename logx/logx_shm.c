@@ -0,0 +1,694 @@
+/**
+ * @file logx_shm.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Shared-memory multi-process logging — segment setup, per-process rings and the
+ *        collector process.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* prctl(PR_SET_NAME) */
+
+#include "logx_shm.h"
+#include "logx.h"
+#include "logx_common.h"
+#include "logx_rotation.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/** @brief "LOGX_SHM", stored once the segment header is complete. */
+#define SHM_MAGIC 0x4d48535f58474f4cULL
+
+/** @brief Round up to a cache line. */
+#define SHM_ALIGN(n) (((n) + 63) & ~(size_t)63)
+
+/** @brief Round up to the 8-byte granularity of records in a ring. */
+#define SHM_REC_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+/** @brief How long `logx_shm_attach()` waits for another process to finish the header. */
+#define SHM_INIT_WAIT_MS 1000
+
+/** @brief Collector poll interval while the rings are empty. */
+#define SHM_POLL_NS 1000000L
+
+/** @brief How often the collector checks whether ring owners are still alive. */
+#define SHM_LIVENESS_MS 100
+
+/**
+ * @brief Segment header, at offset 0.
+ */
+typedef struct
+{
+    uint64_t magic;      /**< `SHM_MAGIC` once `nrings` and `ring_size` are valid. */
+    uint32_t nrings;     /**< Number of rings. */
+    uint32_t ring_size;  /**< Data bytes per ring (multiple of 64). */
+    int32_t collector;   /**< Collector pid; 0 = none, < 0 = being started by that -pid. */
+    uint32_t rotate_seq; /**< Bumped to ask the collector for a rotation. */
+} shm_hdr_t;
+
+/**
+ * @brief Header of one single-producer ring; `ring_size` data bytes follow it.
+ */
+typedef struct
+{
+    int32_t owner;                              /**< pid of the writer; 0 = free. */
+    uint32_t reserved;                          /**< Padding. */
+    uint64_t dropped;                           /**< Records dropped because the ring was full. */
+    uint64_t head __attribute__((aligned(64))); /**< Write position; advanced by the owner. */
+    uint64_t tail __attribute__((aligned(64))); /**< Read position; advanced by the collector. */
+} shm_ring_t;
+
+/**
+ * @brief Header of one record in a ring. Records never wrap around the end of the
+ *        ring; the space they skip is marked with `size` 0 when a header fits.
+ */
+typedef struct
+{
+    uint32_t size;    /**< Bytes taken by the record, header included; 0 = skip to start. */
+    uint32_t len;     /**< Length of the text that follows. */
+    uint64_t time_us; /**< Wall-clock time of the record, for merging. */
+} shm_rec_t;
+
+/**
+ * @brief A logger's attachment to the segment.
+ */
+struct logx_shm_t
+{
+    char name[256];   /**< Shared memory object name, with the leading '/'. */
+    shm_hdr_t *hdr;   /**< Mapped segment. */
+    size_t map_size;  /**< Size of the mapping. */
+    shm_ring_t *ring; /**< Ring claimed by `pid`, or NULL. */
+    pid_t pid;        /**< Process that claimed `ring`. */
+    pid_t warned;     /**< Process that was told there is no free ring. */
+};
+
+/* ── Segment layout ──────────────────────────────────────────────────────── */
+
+/** @brief Bytes needed for a segment of the given geometry. */
+static size_t shm_segment_size(uint32_t nrings, uint32_t ring_size)
+{
+    return SHM_ALIGN(sizeof(shm_hdr_t)) + (size_t)nrings * (sizeof(shm_ring_t) + ring_size);
+}
+
+/** @brief Ring `i` of a segment. */
+static shm_ring_t *shm_ring(shm_hdr_t *h, uint32_t i)
+{
+    return (shm_ring_t *)((char *)h + SHM_ALIGN(sizeof(shm_hdr_t)) +
+                          (size_t)i * (sizeof(shm_ring_t) + h->ring_size));
+}
+
+/** @brief Data area of a ring. */
+static char *shm_ring_data(shm_ring_t *r)
+{
+    return (char *)(r + 1);
+}
+
+/** @brief Monotonic clock in milliseconds. */
+static uint64_t shm_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+/** @brief Sleep for `ns` nanoseconds. */
+static void shm_sleep_ns(long ns)
+{
+    struct timespec ts = {0, ns};
+    nanosleep(&ts, NULL);
+}
+
+/** @brief 1 if process `pid` still exists. */
+static int shm_pid_alive(pid_t pid)
+{
+    return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+/**
+ * @brief Claim a free ring for `pid`.
+ * @return The ring, or NULL if every ring is taken.
+ */
+static shm_ring_t *shm_claim(shm_hdr_t *h, pid_t pid)
+{
+    for (uint32_t i = 0; i < h->nrings; i++)
+    {
+        shm_ring_t *r    = shm_ring(h, i);
+        int32_t expected = 0;
+
+        if (__atomic_compare_exchange_n(&r->owner, &expected, (int32_t)pid, 0, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED))
+            return r;
+    }
+    return NULL;
+}
+
+/* ── Writer side ─────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Copy one record into a ring, waiting up to `LOGX_SHM_FULL_WAIT_MS` for room.
+ * @return 0 on success, -1 if the record was dropped.
+ */
+static int shm_ring_put(shm_ring_t *r, uint32_t cap, const char *text, size_t len,
+                        uint64_t time_us)
+{
+    char *data      = shm_ring_data(r);
+    size_t need     = SHM_REC_ALIGN(sizeof(shm_rec_t) + len);
+    uint64_t head   = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    uint64_t expiry = 0;
+
+    if (need > cap)
+    {
+        len  = cap - sizeof(shm_rec_t);
+        need = cap;
+    }
+
+    size_t off = (size_t)(head % cap);
+    size_t gap = (cap - off < need) ? cap - off : 0;
+
+    while (head + gap + need - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) > cap)
+    {
+        uint64_t now = shm_now_ms();
+        if (!expiry)
+            expiry = now + LOGX_SHM_FULL_WAIT_MS;
+        else if (now >= expiry)
+        {
+            __atomic_add_fetch(&r->dropped, 1, __ATOMIC_RELAXED);
+            return -1;
+        }
+        shm_sleep_ns(100000L);
+    }
+
+    if (gap)
+    {
+        if (gap >= sizeof(shm_rec_t))
+            ((shm_rec_t *)(data + off))->size = 0;
+        head += gap;
+        off = 0;
+    }
+
+    shm_rec_t *rec = (shm_rec_t *)(data + off);
+    rec->size      = (uint32_t)need;
+    rec->len       = (uint32_t)len;
+    rec->time_us   = time_us;
+    memcpy(rec + 1, text, len);
+
+    __atomic_store_n(&r->head, head + need, __ATOMIC_RELEASE);
+    return 0;
+}
+
+logx_errorcodes_t logx_shm_write(logx_shm_t *s, const logx_sink_record_t *records, size_t count)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    pid_t pid              = getpid();
+
+    /* A process forked after logx_create() must not write into its parent's ring */
+    if (s->pid != pid || !s->ring)
+    {
+        s->pid  = pid;
+        s->ring = shm_claim(s->hdr, pid);
+        if (!s->ring)
+        {
+            if (s->warned != pid)
+                fprintf(stderr, "[LogX] No free ring in %s for pid %d, dropping records\n",
+                        s->name, (int)pid);
+            s->warned = pid;
+            return LOGX_ERR_SHM_FAILED;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (shm_ring_put(s->ring, s->hdr->ring_size, records[i].text, records[i].len,
+                         records[i].time_us) != 0)
+            eErr = LOGX_ERR_SHM_FAILED;
+    }
+    return eErr;
+}
+
+void logx_shm_request_rotation(logx_shm_t *s)
+{
+    __atomic_add_fetch(&s->hdr->rotate_seq, 1, __ATOMIC_RELEASE);
+}
+
+/* ── Collector ───────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Next record of a ring between `*pos` and `end`, skipping padding.
+ */
+static const shm_rec_t *shm_ring_peek(shm_ring_t *r, uint32_t cap, uint64_t *pos, uint64_t end)
+{
+    while (*pos < end)
+    {
+        size_t off           = (size_t)(*pos % cap);
+        const shm_rec_t *rec = (const shm_rec_t *)(shm_ring_data(r) + off);
+
+        if (cap - off >= sizeof(shm_rec_t) && rec->size != 0)
+            return rec;
+        *pos += cap - off;
+    }
+    return NULL;
+}
+
+/** @brief Append bytes to the log file as the file sink would, without `flock`. */
+static void collector_write(logx_t *logger, const char *text, size_t len)
+{
+    if (logger->direct)
+        logx_direct_write(logger->direct, text, len);
+    else if (logger->fp)
+        fwrite(text, 1, len, logger->fp);
+}
+
+/**
+ * @brief Write everything currently in the rings, merged by timestamp.
+ * @return Number of records written.
+ */
+static size_t collector_drain(logx_t *logger, shm_hdr_t *h, uint64_t *end, uint64_t *dropped)
+{
+    uint32_t cap = h->ring_size;
+    size_t total = 0;
+    char note[128];
+
+    check_and_rotate_log(logger);
+
+    for (uint32_t i = 0; i < h->nrings; i++)
+    {
+        shm_ring_t *r = shm_ring(h, i);
+        uint64_t d    = __atomic_load_n(&r->dropped, __ATOMIC_RELAXED);
+
+        end[i] = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+        if (d != dropped[i])
+        {
+            int n = snprintf(note, sizeof(note),
+                             "[LogX] %llu records from pid %d dropped: shared-memory ring full\n",
+                             (unsigned long long)(d - dropped[i]),
+                             (int)__atomic_load_n(&r->owner, __ATOMIC_RELAXED));
+            collector_write(logger, note, (size_t)n);
+            dropped[i] = d;
+        }
+    }
+
+    /* k-way merge of what the writers have published so far */
+    for (;;)
+    {
+        const shm_rec_t *best = NULL;
+        shm_ring_t *best_ring = NULL;
+        uint64_t best_pos     = 0;
+
+        for (uint32_t i = 0; i < h->nrings; i++)
+        {
+            shm_ring_t *r        = shm_ring(h, i);
+            uint64_t pos         = r->tail;
+            const shm_rec_t *rec = shm_ring_peek(r, cap, &pos, end[i]);
+
+            if (rec && (!best || rec->time_us < best->time_us))
+            {
+                best      = rec;
+                best_ring = r;
+                best_pos  = pos;
+            }
+        }
+        if (!best)
+            break;
+
+        collector_write(logger, (const char *)(best + 1), best->len);
+        __atomic_store_n(&best_ring->tail, best_pos + best->size, __ATOMIC_RELEASE);
+        total++;
+    }
+
+    if (total && logger->fp)
+        fflush(logger->fp);
+    return total;
+}
+
+/**
+ * @brief Free the rings of processes that are gone once they are drained.
+ * @return 1 if any ring is owned or still holds records.
+ */
+static int collector_rings_in_use(shm_hdr_t *h)
+{
+    int in_use = 0;
+
+    for (uint32_t i = 0; i < h->nrings; i++)
+    {
+        shm_ring_t *r = shm_ring(h, i);
+        int32_t owner = __atomic_load_n(&r->owner, __ATOMIC_ACQUIRE);
+        int empty     = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) == r->tail;
+
+        if (owner && !shm_pid_alive(owner) && empty)
+        {
+            __atomic_compare_exchange_n(&r->owner, &owner, 0, 0, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED);
+            owner = 0;
+        }
+        if (owner || !empty)
+            in_use = 1;
+    }
+    return in_use;
+}
+
+/**
+ * @brief Body of the collector process. Never returns.
+ *
+ * Runs in a copy of the logger that started it; that copy becomes the only
+ * writer of the log file.
+ */
+static void __attribute__((noreturn)) collector_run(logx_t *logger, logx_shm_t *s)
+{
+    shm_hdr_t *h         = s->hdr;
+    uint64_t *end        = calloc(h->nrings, sizeof(*end));
+    uint64_t *dropped    = calloc(h->nrings, sizeof(*dropped));
+    uint32_t rotate_seen = __atomic_load_n(&h->rotate_seq, __ATOMIC_ACQUIRE);
+    uint64_t idle_since  = 0;
+    uint64_t checked_at  = 0;
+    int unlinked         = 0;
+    int in_use           = 1;
+
+    /* Outlive the worker processes and stay out of their terminal's signals */
+    setsid();
+    signal(SIGPIPE, SIG_IGN);
+    prctl(PR_SET_NAME, "logx-collector", 0, 0, 0);
+    __atomic_store_n(&h->collector, (int32_t)getpid(), __ATOMIC_RELEASE);
+
+    logger->shm = NULL;
+    logger->fp  = fopen(logger->cfg.file_path, "a");
+    if (!end || !dropped || !logger->fp)
+    {
+        fprintf(stderr, "[LogX] Collector for %s could not start\n", s->name);
+        __atomic_store_n(&h->collector, 0, __ATOMIC_RELEASE);
+        _exit(1);
+    }
+    logger->fd = fileno(logger->fp);
+    logx_direct_start(logger);
+    logx_rotation_today(logger->current_date, sizeof(logger->current_date));
+
+    for (;;)
+    {
+        size_t written = collector_drain(logger, h, end, dropped);
+        uint32_t seq   = __atomic_load_n(&h->rotate_seq, __ATOMIC_ACQUIRE);
+        uint64_t now   = shm_now_ms();
+
+        if (seq != rotate_seen)
+        {
+            rotate_seen = seq;
+            logx_rotate_now(logger);
+        }
+
+        if (written)
+        {
+            idle_since = 0;
+            continue;
+        }
+
+        if (now - checked_at >= SHM_LIVENESS_MS)
+        {
+            checked_at = now;
+            in_use     = collector_rings_in_use(h);
+        }
+
+        if (in_use)
+            idle_since = 0;
+        else if (!idle_since)
+            idle_since = now;
+        else if (now - idle_since >= LOGX_SHM_IDLE_EXIT_MS)
+        {
+            if (unlinked)
+                break;
+
+            /* New processes start a new segment; serve anyone who attached meanwhile */
+            __atomic_store_n(&h->collector, 0, __ATOMIC_RELEASE);
+            shm_unlink(s->name);
+            unlinked   = 1;
+            idle_since = 0;
+            checked_at = 0;
+            continue;
+        }
+
+        shm_sleep_ns(SHM_POLL_NS);
+    }
+
+    logx_direct_stop(logger);
+    fclose(logger->fp);
+    _exit(0);
+}
+
+/**
+ * @brief Whether the calling process runs no thread but the caller.
+ *
+ * The forked collector goes on to use stdio, malloc, zlib and a thread of its
+ * own, which is only safe if no other thread can hold one of their locks at the
+ * time of the fork.
+ */
+static int shm_single_threaded(void)
+{
+    char buf[512];
+    long threads = 0;
+    int fd       = open("/proc/self/stat", O_RDONLY | O_CLOEXEC);
+    ssize_t n    = fd >= 0 ? read(fd, buf, sizeof(buf) - 1) : -1;
+
+    if (fd >= 0)
+        close(fd);
+    if (n <= 0)
+        return 0;
+    buf[n] = '\0';
+
+    /* num_threads is field 20; the command name in field 2 may contain anything but ')' */
+    const char *p = strrchr(buf, ')');
+    if (!p || sscanf(p + 1,
+                     " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d %*d %ld",
+                     &threads) != 1)
+        return 0;
+    return threads == 1;
+}
+
+/**
+ * @brief Fork the collector. The intermediate child exits at once, so the collector
+ *        is not left behind as a zombie of the logging process.
+ *
+ * Only a single-threaded process forks it; otherwise the caller writes the file
+ * itself and the collector is left to a later process.
+ */
+static logx_errorcodes_t shm_start_collector(logx_t *logger, logx_shm_t *s)
+{
+    if (!shm_single_threaded())
+    {
+        fprintf(stderr, "[LogX] Not starting the collector for %s: other threads are running\n",
+                s->name);
+        __atomic_store_n(&s->hdr->collector, 0, __ATOMIC_RELEASE);
+        return LOGX_ERR_SHM_FAILED;
+    }
+
+    pid_t child = fork();
+
+    if (child < 0)
+    {
+        __atomic_store_n(&s->hdr->collector, 0, __ATOMIC_RELEASE);
+        return LOGX_ERR_SHM_FAILED;
+    }
+
+    if (child == 0)
+    {
+        pid_t collector = fork();
+        if (collector == 0)
+            collector_run(logger, s);
+        _exit(collector < 0);
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        __atomic_store_n(&s->hdr->collector, 0, __ATOMIC_RELEASE);
+        return LOGX_ERR_SHM_FAILED;
+    }
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Become the process that starts the collector if there is none.
+ * @return 1 if the caller must start it.
+ */
+static int shm_take_collector(shm_hdr_t *h)
+{
+    int32_t current = __atomic_load_n(&h->collector, __ATOMIC_ACQUIRE);
+
+    if (current != 0 && shm_pid_alive(current < 0 ? -current : current))
+        return 0;
+    return __atomic_compare_exchange_n(&h->collector, &current, -(int32_t)getpid(), 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+/* ── Attach / detach ─────────────────────────────────────────────────────── */
+
+/**
+ * @brief Map the segment `fd`, waiting for its creator to publish the geometry.
+ * @return 0 on success, -1 on failure.
+ */
+static int shm_map_existing(int fd, logx_shm_t *s)
+{
+    uint64_t expiry = shm_now_ms() + SHM_INIT_WAIT_MS;
+    shm_hdr_t *hdr  = MAP_FAILED;
+    struct stat st;
+
+    /* The creator sizes the object right after creating it */
+    while (fstat(fd, &st) == 0 && (size_t)st.st_size < sizeof(shm_hdr_t))
+    {
+        if (shm_now_ms() >= expiry)
+            return -1;
+        shm_sleep_ns(SHM_POLL_NS);
+    }
+
+    hdr = mmap(NULL, sizeof(shm_hdr_t), PROT_READ, MAP_SHARED, fd, 0);
+    if (hdr == MAP_FAILED)
+        return -1;
+    while (__atomic_load_n(&hdr->magic, __ATOMIC_ACQUIRE) != SHM_MAGIC)
+    {
+        if (shm_now_ms() >= expiry)
+        {
+            munmap(hdr, sizeof(shm_hdr_t));
+            return -1;
+        }
+        shm_sleep_ns(SHM_POLL_NS);
+    }
+    s->map_size = shm_segment_size(hdr->nrings, hdr->ring_size);
+    munmap(hdr, sizeof(shm_hdr_t));
+
+    s->hdr = mmap(NULL, s->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (s->hdr == MAP_FAILED)
+    {
+        s->hdr = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+logx_errorcodes_t logx_shm_attach(logx_t *logger)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_shm_t *s          = NULL;
+    int fd                 = -1;
+    int created            = 0;
+    size_t ring_size       = 0;
+    uint32_t nrings        = 0;
+
+    /* Sanity check */
+    if (!logger->cfg.shm_name || !*logger->cfg.shm_name || !logger->cfg.file_path)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    s = calloc(1, sizeof(*s));
+    if (!s)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+    snprintf(s->name, sizeof(s->name), "%s%s", logger->cfg.shm_name[0] == '/' ? "" : "/",
+             logger->cfg.shm_name);
+
+    ring_size = (size_t)(logger->cfg.shm_ring_size > LOGX_SHM_MIN_RING_SIZE
+                             ? logger->cfg.shm_ring_size
+                             : LOGX_SHM_MIN_RING_SIZE);
+    ring_size = SHM_ALIGN(ring_size);
+    nrings    = (uint32_t)(logger->cfg.shm_rings > 0 ? logger->cfg.shm_rings : 1);
+
+    fd = shm_open(s->name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd >= 0)
+    {
+        created     = 1;
+        s->map_size = shm_segment_size(nrings, (uint32_t)ring_size);
+        if (ftruncate(fd, (off_t)s->map_size) != 0)
+        {
+            eErr = LOGX_ERR_SHM_FAILED;
+            goto END;
+        }
+        s->hdr = mmap(NULL, s->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (s->hdr == MAP_FAILED)
+        {
+            s->hdr = NULL;
+            eErr   = LOGX_ERR_SHM_FAILED;
+            goto END;
+        }
+        s->hdr->nrings    = nrings;
+        s->hdr->ring_size = (uint32_t)ring_size;
+        s->hdr->collector = -(int32_t)getpid();
+        __atomic_store_n(&s->hdr->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+    }
+    else if (errno == EEXIST)
+    {
+        fd = shm_open(s->name, O_RDWR | O_CLOEXEC, 0);
+        if (fd < 0 || shm_map_existing(fd, s) != 0)
+        {
+            eErr = LOGX_ERR_SHM_FAILED;
+            goto END;
+        }
+    }
+    else
+    {
+        eErr = LOGX_ERR_SHM_FAILED;
+        goto END;
+    }
+
+    s->pid  = getpid();
+    s->ring = shm_claim(s->hdr, s->pid);
+    if (!s->ring)
+    {
+        eErr = LOGX_ERR_SHM_FAILED;
+        goto END;
+    }
+
+    /* The first process starts the collector; later ones replace one that died */
+    if (created || shm_take_collector(s->hdr))
+    {
+        eErr = shm_start_collector(logger, s);
+        if (eErr != LOGX_ERR_SUCCESS)
+            goto END;
+    }
+
+    logger->shm = s;
+    s           = NULL;
+
+END:
+    if (fd >= 0)
+        close(fd);
+    if (s)
+    {
+        if (s->ring)
+            __atomic_store_n(&s->ring->owner, 0, __ATOMIC_RELEASE);
+        if (s->hdr)
+            munmap(s->hdr, s->map_size);
+        if (created)
+            shm_unlink(s->name);
+        free(s);
+    }
+    return eErr;
+}
+
+void logx_shm_detach(logx_t *logger)
+{
+    logx_shm_t *s = logger->shm;
+
+    if (!s)
+        return;
+
+    /* Records still in the ring are written by the collector after we are gone */
+    if (s->ring && s->pid == getpid())
+        __atomic_store_n(&s->ring->owner, 0, __ATOMIC_RELEASE);
+
+    munmap(s->hdr, s->map_size);
+    free(s);
+    logger->shm = NULL;
+}
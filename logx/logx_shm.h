@@ -0,0 +1,105 @@
+/**
+ * @file logx_shm.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Shared-memory multi-process logging — per-process rings in a POSIX shared
+ *        memory segment, drained into the log file by a collector process.
+ *
+ * With `shm_name` set, the built-in file sink no longer opens the log file.
+ * Each process (each logger, in fact) claims one single-producer ring of
+ * `shm_ring_size` bytes in the shared memory object `shm_name` and copies its
+ * rendered records into it, without `flock` or any other lock shared between
+ * processes. The first `logx_create()` that finds no segment creates it and
+ * forks a `logx-collector` process. The collector drains the rings, merges the
+ * available records by timestamp, writes the log file and is the only process
+ * that rotates it. `logx_rotate_now()` in any process asks the collector to
+ * rotate.
+ *
+ * A process that forks after `logx_create()` (a prefork server) claims a ring
+ * of its own on its first write. Rings of processes that exited are drained and
+ * handed out again. When a ring stays full for `LOGX_SHM_FULL_WAIT_MS`, the
+ * record is dropped, and the collector writes how many records were dropped.
+ * The collector exits and removes the segment once no process has had a ring
+ * for `LOGX_SHM_IDLE_EXIT_MS`.
+ *
+ * All processes must use the same `shm_name`, file path and rotation settings;
+ * the collector uses those of the process that started it.
+ *
+ * The collector is forked from the process that starts it and keeps using stdio,
+ * malloc, zlib and threads, so it is only started from a process that runs no
+ * other thread yet (no application threads and no thread of another logger).
+ * A multi-threaded process that would have to start it writes the log file
+ * directly instead, and leaves the segment to the next process.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_SHM_H
+#define LOGX_SHM_H
+
+#include "logx_errorcodes.h"
+#include "logx_sink.h"
+#include "logx_types.h"
+#include <stddef.h>
+
+/** @brief How long a writer waits for room in a full ring before dropping the record. */
+#ifndef LOGX_SHM_FULL_WAIT_MS
+#define LOGX_SHM_FULL_WAIT_MS 10
+#endif
+
+/** @brief How long the collector keeps running after the last ring was released. */
+#ifndef LOGX_SHM_IDLE_EXIT_MS
+#define LOGX_SHM_IDLE_EXIT_MS 1000
+#endif
+
+/** @brief Smallest ring size in bytes; smaller `shm_ring_size` values are raised to it. */
+#ifndef LOGX_SHM_MIN_RING_SIZE
+#define LOGX_SHM_MIN_RING_SIZE (64 * 1024)
+#endif
+
+/** @brief Opaque shared-memory attachment owned by a logger. */
+typedef struct logx_shm_t logx_shm_t;
+
+/**
+ * @brief Internal — attach the logger to `cfg.shm_name`, creating the segment and
+ *        starting the collector if needed.
+ * @internal
+ *
+ * Must be called from `logx_create()` before any thread of the logger is started.
+ *
+ * @param[in,out] logger Logger instance with `shm_name` and `file_path` set.
+ * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_NO_MEM`, or `LOGX_ERR_SHM_FAILED` if the
+ *         segment cannot be used or every ring is taken.
+ */
+logx_errorcodes_t logx_shm_attach(logx_t *logger);
+
+/**
+ * @brief Internal — release the logger's ring, if it has one.
+ * @internal
+ * @param[in,out] logger Logger instance.
+ */
+void logx_shm_detach(logx_t *logger);
+
+/**
+ * @brief Internal — copy rendered records into this process's ring.
+ * @internal
+ *
+ * Must be called with the file sink lock held.
+ *
+ * @param[in,out] s       Attachment.
+ * @param[in]     records Records, oldest first.
+ * @param[in]     count   Number of records.
+ * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_SHM_FAILED` if a record was dropped.
+ */
+logx_errorcodes_t logx_shm_write(logx_shm_t *s, const logx_sink_record_t *records, size_t count);
+
+/**
+ * @brief Internal — ask the collector to rotate the log file.
+ * @internal
+ * @param[in,out] s Attachment.
+ */
+void logx_shm_request_rotation(logx_shm_t *s);
+
+#endif /* LOGX_SHM_H */
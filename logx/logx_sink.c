@@ -0,0 +1,729 @@
+/**
+ * @file logx_sink.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Pluggable output sinks — sink list, batching and the built-in console, file and
+ *        syslog sinks.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* pthread_setname_np */
+
+#include "logx_sink.h"
+#include "logx.h"
+#include "logx_common.h"
+#include "logx_rotation.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <syslog.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Built-in sinks, attached by logx_sinks_init() in this order */
+#define LOGX_SINK_CONSOLE       0
+#define LOGX_SINK_FILE          1
+#define LOGX_SINK_SYSLOG        2
+#define LOGX_SINK_BUILTIN_COUNT 3
+
+/* ── Built-in sinks ──────────────────────────────────────────────────────── */
+
+/** @brief Console sink: WARN and above go to stderr, the rest to stdout. */
+static logx_errorcodes_t console_write_batch(void *ctx, const logx_sink_record_t *records,
+                                             size_t count)
+{
+    (void)ctx;
+    for (size_t i = 0; i < count; i++)
+    {
+        FILE *out = (records[i].level >= LOGX_LEVEL_WARN) ? stderr : stdout;
+        fwrite(records[i].text, 1, records[i].len, out);
+    }
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Write all of `len` bytes to `fd`, retrying after signals and short writes.
+ * @return 0 on success, -1 on error.
+ */
+static int write_all(int fd, const char *buf, size_t len)
+{
+    while (len)
+    {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief Append records without `flock`: each `write()` on the `O_APPEND` descriptor
+ *        carries whole records only, so records of other processes never land inside one.
+ *        Records that are adjacent in the batch buffer are coalesced up to
+ *        `LOGX_ATOMIC_APPEND_MAX` bytes; a longer record is written under the file lock.
+ */
+static logx_errorcodes_t file_append_atomic(logx_t *logger, const logx_sink_record_t *records,
+                                            size_t count)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    size_t i               = 0;
+
+    while (i < count)
+    {
+        const char *start = records[i].text;
+        size_t len        = records[i].len;
+
+        if (len > LOGX_ATOMIC_APPEND_MAX)
+        {
+            exclusive_flock(logger->fd);
+            if (write_all(logger->fd, start, len) != 0)
+                eErr = LOGX_ERR_FILE_WRITE_FAILED;
+            unlock_flock(logger->fd);
+            i++;
+            continue;
+        }
+
+        while (++i < count && records[i].text == start + len &&
+               len + records[i].len <= LOGX_ATOMIC_APPEND_MAX)
+            len += records[i].len;
+
+        if (write_all(logger->fd, start, len) != 0)
+            eErr = LOGX_ERR_FILE_WRITE_FAILED;
+    }
+
+    return eErr;
+}
+
+/** @brief File sink: rotate if due, then write the batch under the file lock, with single
+ *         `O_APPEND` writes or through the O_DIRECT writer; in shared-memory mode, hand it to
+ *         the collector's ring. */
+static logx_errorcodes_t file_write_batch(void *ctx, const logx_sink_record_t *records,
+                                          size_t count)
+{
+    logx_t *logger         = ctx;
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* The collector process owns the file and its rotation */
+    if (logger->shm)
+        return logx_shm_write(logger->shm, records, count);
+
+    /* Rotation switches file logging off when it cannot reopen the file */
+    if (!__atomic_load_n(&logger->cfg.enable_file_logging, __ATOMIC_RELAXED))
+        return LOGX_ERR_FILE_WRITE_FAILED;
+
+    check_and_rotate_log(logger);
+    if (!logger->fp)
+        return LOGX_ERR_FILE_WRITE_FAILED;
+
+    if (logger->direct)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (logx_direct_write(logger->direct, records[i].text, records[i].len) !=
+                LOGX_ERR_SUCCESS)
+                eErr = LOGX_ERR_FILE_WRITE_FAILED;
+        }
+        return eErr;
+    }
+
+    /* stdio is bypassed, and flushed after every batch, so nothing is left in its buffer */
+    if (logger->cfg.file_atomic_append && logger->fd >= 0)
+        return file_append_atomic(logger, records, count);
+
+    if (logger->fd >= 0)
+        exclusive_flock(logger->fd);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (fwrite(records[i].text, 1, records[i].len, logger->fp) != records[i].len)
+            eErr = LOGX_ERR_FILE_WRITE_FAILED;
+    }
+    fflush(logger->fp);
+
+    if (logger->fd >= 0)
+        unlock_flock(logger->fd);
+
+    return eErr;
+}
+
+/** @brief File sink flush. */
+static logx_errorcodes_t file_flush(void *ctx)
+{
+    logx_t *logger = ctx;
+
+    if (logger->direct)
+        return logx_direct_sync(logger->direct);
+    if (logger->fp)
+        fflush(logger->fp);
+    return LOGX_ERR_SUCCESS;
+}
+
+/** @brief Syslog sink — syslog adds its own timestamp. */
+static logx_errorcodes_t syslog_write_batch(void *ctx, const logx_sink_record_t *records,
+                                            size_t count)
+{
+    (void)ctx;
+    for (size_t i = 0; i < count; i++)
+        syslog(logx_level_to_syslog_priority(records[i].level), "%.*s", (int)records[i].len,
+               records[i].text);
+    return LOGX_ERR_SUCCESS;
+}
+
+static const logx_sink_ops_t g_console_ops = {.write_batch = console_write_batch};
+static const logx_sink_ops_t g_file_ops    = {.write_batch = file_write_batch,
+                                              .flush       = file_flush};
+static const logx_sink_ops_t g_syslog_ops  = {.write_batch = syslog_write_batch};
+
+/* ── Batching ────────────────────────────────────────────────────────────── */
+
+/* The helpers below run with the sink's lock held, or on a sink no record can reach */
+
+/**
+ * @brief Count a failed callback of a sink.
+ * @return `eErr`.
+ */
+static logx_errorcodes_t sink_check(logx_sink_t *sink, logx_errorcodes_t eErr)
+{
+    if (eErr != LOGX_ERR_SUCCESS && sink->errors)
+        __atomic_fetch_add(sink->errors, 1, __ATOMIC_RELAXED);
+    return eErr;
+}
+
+/**
+ * @brief Hand a sink's buffered records to `write_batch` and empty the buffer.
+ * @return The result of `write_batch`.
+ */
+static logx_errorcodes_t sink_write_pending(logx_sink_t *sink)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    if (!sink->batch_count)
+        return LOGX_ERR_SUCCESS;
+
+    eErr = sink_check(sink, sink->ops->write_batch(sink->ctx, sink->batch, sink->batch_count));
+
+    sink->batch_count = 0;
+    sink->buf_used    = 0;
+    return eErr;
+}
+
+/**
+ * @brief Write pending records and flush the sink itself.
+ * @return The first error of `write_batch` and `flush`.
+ */
+static logx_errorcodes_t sink_flush(logx_sink_t *sink)
+{
+    logx_errorcodes_t eErr = sink_write_pending(sink);
+
+    if (sink->ops->flush)
+    {
+        logx_errorcodes_t flush_err = sink_check(sink, sink->ops->flush(sink->ctx));
+        if (eErr == LOGX_ERR_SUCCESS)
+            eErr = flush_err;
+    }
+    return eErr;
+}
+
+/**
+ * @brief (Re)size a sink's batch buffer. Pending records are written first.
+ * @return `LOGX_ERR_SUCCESS` or `LOGX_ERR_NO_MEM` (the sink is then unbuffered).
+ */
+static logx_errorcodes_t sink_set_buffer(logx_sink_t *sink, size_t size)
+{
+    sink_write_pending(sink);
+    free(sink->buf);
+    sink->buf         = NULL;
+    sink->buffer_size = 0;
+
+    if (!size)
+        return LOGX_ERR_SUCCESS;
+
+    sink->buf = malloc(size);
+    if (!sink->buf)
+        return LOGX_ERR_NO_MEM;
+    sink->buffer_size = size;
+    return LOGX_ERR_SUCCESS;
+}
+
+void logx_sink_push(logx_sink_t *sink, const logx_sink_record_t *record, uint64_t now_ms)
+{
+    pthread_mutex_lock(&sink->lock);
+
+    /* Unbuffered, or too big to ever fit: hand it over as a batch of one */
+    if (!sink->buffer_size || record->len > sink->buffer_size)
+    {
+        sink_write_pending(sink);
+        sink_check(sink, sink->ops->write_batch(sink->ctx, record, 1));
+        pthread_mutex_unlock(&sink->lock);
+        return;
+    }
+
+    if (sink->batch_count == LOGX_SINK_BATCH_MAX ||
+        sink->buf_used + record->len > sink->buffer_size)
+        sink_write_pending(sink);
+
+    if (!sink->batch_count)
+        sink->batch_since_ms = now_ms;
+
+    logx_sink_record_t *slot = &sink->batch[sink->batch_count++];
+    memcpy(sink->buf + sink->buf_used, record->text, record->len);
+    slot->level   = record->level;
+    slot->text    = sink->buf + sink->buf_used;
+    slot->len     = record->len;
+    slot->time_us = record->time_us;
+    sink->buf_used += record->len;
+
+    /* Errors should reach the destination at once; nothing waits longer than the interval */
+    if (record->level >= LOGX_LEVEL_ERROR || now_ms < sink->batch_since_ms ||
+        now_ms - sink->batch_since_ms >= LOGX_SINK_FLUSH_INTERVAL_MS)
+        sink_write_pending(sink);
+
+    pthread_mutex_unlock(&sink->lock);
+}
+
+/* ── Flusher thread ──────────────────────────────────────────────────────── */
+
+/**
+ * @brief `logx-flush` thread of one logger.
+ */
+struct logx_sink_flusher_t
+{
+    logx_t *logger;       /**< Logger whose dedup summaries it writes. */
+    logx_sink_set_t *set; /**< Sink list it watches. */
+    pthread_t thread;     /**< The thread. */
+    pthread_mutex_t lock; /**< Protects `stop`. */
+    pthread_cond_t wake;  /**< Signalled to stop the thread. */
+    int stop;             /**< 1 = exit. */
+};
+
+/** @brief Wall-clock time in milliseconds, as records carry it. */
+static uint64_t sink_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+/**
+ * @brief Hand over every batch older than `LOGX_SINK_FLUSH_INTERVAL_MS`.
+ */
+static void sinks_write_aged(logx_sink_set_t *set)
+{
+    /* Whoever holds the list for writing (sink changes, destroy) flushes itself */
+    if (pthread_rwlock_tryrdlock(&set->lock) != 0)
+        return;
+
+    uint64_t now = sink_now_ms();
+    for (int i = 0; i < set->count; i++)
+    {
+        logx_sink_t *sink = set->list[i];
+
+        pthread_mutex_lock(&sink->lock);
+        if (sink->batch_count && (now < sink->batch_since_ms ||
+                                  now - sink->batch_since_ms >= LOGX_SINK_FLUSH_INTERVAL_MS))
+            sink_write_pending(sink);
+        pthread_mutex_unlock(&sink->lock);
+    }
+
+    pthread_rwlock_unlock(&set->lock);
+}
+
+/** @brief Body of the `logx-flush` thread. */
+static void *sinks_flush_thread(void *arg)
+{
+    logx_sink_flusher_t *f = arg;
+
+    pthread_mutex_lock(&f->lock);
+    while (!f->stop)
+    {
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_sec += LOGX_SINK_FLUSH_TICK_MS / 1000;
+        until.tv_nsec += (long)(LOGX_SINK_FLUSH_TICK_MS % 1000) * 1000000L;
+        if (until.tv_nsec >= 1000000000L)
+        {
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000L;
+        }
+
+        if (pthread_cond_timedwait(&f->wake, &f->lock, &until) == ETIMEDOUT && !f->stop)
+        {
+            pthread_mutex_unlock(&f->lock);
+            logx_dedup_write_aged(f->logger);
+            sinks_write_aged(f->set);
+            pthread_mutex_lock(&f->lock);
+        }
+    }
+    pthread_mutex_unlock(&f->lock);
+    return NULL;
+}
+
+/**
+ * @brief Start the `logx-flush` thread of a logger if it has none yet.
+ *
+ * Called with the logger lock held. Without the thread (it cannot be created),
+ * batches and dedup summaries are still handed over by the other triggers.
+ */
+static void sinks_start_flusher(logx_t *logger)
+{
+    logx_sink_set_t *set   = &logger->sinks;
+    logx_sink_flusher_t *f = NULL;
+
+    if (set->flusher)
+        return;
+
+    f = calloc(1, sizeof(*f));
+    if (!f)
+        return;
+    f->logger = logger;
+    f->set    = set;
+    pthread_mutex_init(&f->lock, NULL);
+    pthread_cond_init(&f->wake, NULL);
+
+    if (pthread_create(&f->thread, NULL, sinks_flush_thread, f) != 0)
+    {
+        fprintf(stderr, "[LogX] Failed to start the sink flusher thread\n");
+        pthread_cond_destroy(&f->wake);
+        pthread_mutex_destroy(&f->lock);
+        free(f);
+        return;
+    }
+    pthread_setname_np(f->thread, "logx-flush");
+    set->flusher = f;
+}
+
+/**
+ * @brief Stop and free the `logx-flush` thread of a sink list, if any.
+ *
+ * Safe with the list locked for writing: the thread never waits for the list lock.
+ */
+static void sinks_stop_flusher(logx_sink_set_t *set)
+{
+    logx_sink_flusher_t *f = set->flusher;
+
+    if (!f)
+        return;
+
+    pthread_mutex_lock(&f->lock);
+    f->stop = 1;
+    pthread_cond_signal(&f->wake);
+    pthread_mutex_unlock(&f->lock);
+    pthread_join(f->thread, NULL);
+
+    pthread_cond_destroy(&f->wake);
+    pthread_mutex_destroy(&f->lock);
+    free(f);
+    set->flusher = NULL;
+}
+
+/* ── Sink list ───────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Recompute the lowest level taken by an enabled sink that needs no record flags.
+ *
+ * Called with the logger lock held whenever a sink's level, state or membership changed.
+ */
+static void sinks_update_floor(logx_sink_set_t *set)
+{
+    logx_level_t floor = LOGX_LEVEL_OFF;
+
+    for (int i = 0; i < set->count; i++)
+    {
+        const logx_sink_t *sink = set->list[i];
+        if (sink->enabled && !sink->required_flags && sink->level < floor)
+            floor = sink->level;
+    }
+    __atomic_store_n(&set->floor, floor, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Free a sink that was never opened or attached.
+ */
+static void sink_discard(logx_sink_t *sink)
+{
+    pthread_mutex_destroy(&sink->lock);
+    free(sink->buf);
+    free(sink->name);
+    free(sink);
+}
+
+/**
+ * @brief Allocate a sink with the given callbacks and settings.
+ * @return The new sink, or NULL on allocation failure.
+ */
+static logx_sink_t *sink_new(const char *name, const logx_sink_ops_t *ops, void *ctx,
+                             logx_level_t level, logx_sink_format_t format, size_t buffer_size)
+{
+    logx_sink_t *sink = calloc(1, sizeof(*sink));
+    if (!sink)
+        return NULL;
+
+    pthread_mutex_init(&sink->lock, NULL);
+    sink->name    = strdup(name ? name : "sink");
+    sink->ops     = ops;
+    sink->ctx     = ctx;
+    sink->enabled = 1;
+    sink->level   = level;
+    sink->format  = format;
+
+    if (!sink->name || sink_set_buffer(sink, buffer_size) != LOGX_ERR_SUCCESS)
+    {
+        sink_discard(sink);
+        return NULL;
+    }
+    return sink;
+}
+
+/**
+ * @brief Flush, close and free one sink. No record may be on its way to it.
+ */
+static void sink_free(logx_sink_t *sink)
+{
+    sink_flush(sink);
+    if (sink->ops->close)
+        sink->ops->close(sink->ctx);
+    sink_discard(sink);
+}
+
+logx_errorcodes_t logx_sinks_init(logx_t *logger)
+{
+    logx_sink_set_t *set = &logger->sinks;
+
+    set->list[LOGX_SINK_CONSOLE] = sink_new("console", &g_console_ops, logger,
+                                            logger->cfg.console_level, LOGX_SINK_FORMAT_PLAIN, 0);
+    set->list[LOGX_SINK_FILE]    = sink_new("file", &g_file_ops, logger, logger->cfg.file_level,
+                                            LOGX_SINK_FORMAT_PLAIN, 0);
+    set->list[LOGX_SINK_SYSLOG] =
+        sink_new("syslog", &g_syslog_ops, logger, LOGX_LEVEL_TRACE, LOGX_SINK_FORMAT_SYSLOG, 0);
+    set->count = LOGX_SINK_BUILTIN_COUNT;
+
+    for (int i = 0; i < LOGX_SINK_BUILTIN_COUNT; i++)
+    {
+        if (!set->list[i])
+        {
+            logx_sinks_destroy(logger);
+            return LOGX_ERR_NO_MEM;
+        }
+        set->list[i]->errors = &logger->stats.write_errors;
+    }
+    set->list[LOGX_SINK_SYSLOG]->required_flags = LOGX_FLAG_SYSLOG;
+
+    logx_sinks_sync(logger);
+    return LOGX_ERR_SUCCESS;
+}
+
+void logx_sinks_destroy(logx_t *logger)
+{
+    logx_sink_set_t *set = &logger->sinks;
+
+    sinks_stop_flusher(set);
+
+    /* Custom sinks first, in reverse order of attachment */
+    for (int i = set->count - 1; i >= 0; i--)
+    {
+        if (set->list[i])
+            sink_free(set->list[i]);
+        set->list[i] = NULL;
+    }
+    set->count = 0;
+    __atomic_store_n(&set->floor, LOGX_LEVEL_OFF, __ATOMIC_RELAXED);
+}
+
+void logx_sinks_sync(logx_t *logger)
+{
+    logx_sink_t *console = logger->sinks.list[LOGX_SINK_CONSOLE];
+    logx_sink_t *file    = logger->sinks.list[LOGX_SINK_FILE];
+    logx_sink_t *sys     = logger->sinks.list[LOGX_SINK_SYSLOG];
+
+    /* Records in flight read these without a lock */
+    __atomic_store_n(&console->enabled, logger->cfg.enable_console_logging, __ATOMIC_RELAXED);
+    __atomic_store_n(&console->level, logger->cfg.console_level, __ATOMIC_RELAXED);
+    __atomic_store_n(&console->format,
+                     logger->cfg.enable_colored_logs ? LOGX_SINK_FORMAT_COLOR
+                                                     : LOGX_SINK_FORMAT_PLAIN,
+                     __ATOMIC_RELAXED);
+
+    logx_file_sink_lock(logger);
+    __atomic_store_n(&file->enabled, logger->cfg.enable_file_logging && (logger->fp || logger->shm),
+                     __ATOMIC_RELAXED);
+    __atomic_store_n(&file->level, logger->cfg.file_level, __ATOMIC_RELAXED);
+    if (logger->cfg.file_buffer_size >= 0 &&
+        (size_t)logger->cfg.file_buffer_size != file->buffer_size)
+        sink_set_buffer(file, (size_t)logger->cfg.file_buffer_size);
+    logx_file_sink_unlock(logger);
+
+    /* The flush thread also writes the dedup summary of a logger that went quiet */
+    if (file->buffer_size || logger->cfg.dedup_window_ms > 0)
+        sinks_start_flusher(logger);
+
+    __atomic_store_n(&sys->enabled, logger->cfg.enable_syslog, __ATOMIC_RELAXED);
+
+    sinks_update_floor(&logger->sinks);
+}
+
+logx_errorcodes_t logx_sinks_flush_locked(logx_t *logger)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    for (int i = 0; i < logger->sinks.count; i++)
+    {
+        logx_sink_t *sink = logger->sinks.list[i];
+
+        pthread_mutex_lock(&sink->lock);
+        logx_errorcodes_t sink_err = sink_flush(sink);
+        pthread_mutex_unlock(&sink->lock);
+
+        if (eErr == LOGX_ERR_SUCCESS)
+            eErr = sink_err;
+    }
+    return eErr;
+}
+
+int logx_sinks_wanted(const logx_sink_set_t *set, logx_level_t level, uint32_t flags, int forced)
+{
+    if (forced || level >= __atomic_load_n(&set->floor, __ATOMIC_RELAXED))
+        return 1;
+
+    /* The syslog sink only takes flagged records and is left out of the floor */
+    return (flags & LOGX_FLAG_SYSLOG) && set->count > LOGX_SINK_SYSLOG &&
+           logx_sink_accepts(set->list[LOGX_SINK_SYSLOG], level, flags, 0);
+}
+
+void logx_file_sink_lock(logx_t *logger)
+{
+    if (logger->sinks.list[LOGX_SINK_FILE])
+        pthread_mutex_lock(&logger->sinks.list[LOGX_SINK_FILE]->lock);
+}
+
+void logx_file_sink_unlock(logx_t *logger)
+{
+    if (logger->sinks.list[LOGX_SINK_FILE])
+        pthread_mutex_unlock(&logger->sinks.list[LOGX_SINK_FILE]->lock);
+}
+
+logx_errorcodes_t logx_file_sink_write_pending(logx_t *logger)
+{
+    if (!logger->sinks.list[LOGX_SINK_FILE])
+        return LOGX_ERR_SUCCESS;
+    return sink_write_pending(logger->sinks.list[LOGX_SINK_FILE]);
+}
+
+/* ── Public API ──────────────────────────────────────────────────────────── */
+
+logx_errorcodes_t logx_add_sink(logx_t *logger, const logx_sink_ops_t *ops, void *ctx,
+                                const logx_sink_cfg_t *cfg, logx_sink_t **out)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_sink_t *sink      = NULL;
+
+    /* Sanity check */
+    if (!logger || !ops || !ops->write_batch || !cfg || cfg->format < 0 ||
+        cfg->format >= LOGX_SINK_FORMAT_COUNT ||
+        is_valid_logx_level(cfg->level) != LOGX_ERR_SUCCESS)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    sink = sink_new(cfg->name, ops, ctx, cfg->level, cfg->format, cfg->buffer_size);
+    if (!sink)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    if (ops->open && (eErr = ops->open(ctx)) != LOGX_ERR_SUCCESS)
+        goto END;
+    sink->errors = &logger->stats.write_errors;
+
+    pthread_mutex_lock(&logger->lock);
+    pthread_rwlock_wrlock(&logger->sinks.lock);
+    if (logger->sinks.count >= LOGX_MAX_SINKS)
+        eErr = LOGX_ERR_INVALID_ARG;
+    else
+        logger->sinks.list[logger->sinks.count++] = sink;
+    sinks_update_floor(&logger->sinks);
+    pthread_rwlock_unlock(&logger->sinks.lock);
+    if (eErr == LOGX_ERR_SUCCESS && sink->buffer_size)
+        sinks_start_flusher(logger);
+    pthread_mutex_unlock(&logger->lock);
+
+    if (eErr != LOGX_ERR_SUCCESS && ops->close)
+        ops->close(ctx);
+
+END:
+    if (eErr != LOGX_ERR_SUCCESS && sink)
+    {
+        sink_discard(sink);
+        sink = NULL;
+    }
+    if (out)
+        *out = sink;
+    return eErr;
+}
+
+logx_errorcodes_t logx_remove_sink(logx_t *logger, logx_sink_t *sink)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_INVALID_ARG;
+
+    /* Sanity check */
+    if (!logger || !sink)
+        return LOGX_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&logger->lock);
+    pthread_rwlock_wrlock(&logger->sinks.lock);
+    for (int i = LOGX_SINK_BUILTIN_COUNT; i < logger->sinks.count; i++)
+    {
+        if (logger->sinks.list[i] != sink)
+            continue;
+
+        memmove(&logger->sinks.list[i], &logger->sinks.list[i + 1],
+                (size_t)(logger->sinks.count - i - 1) * sizeof(logger->sinks.list[0]));
+        logger->sinks.list[--logger->sinks.count] = NULL;
+        sink_free(sink);
+        sinks_update_floor(&logger->sinks);
+        eErr = LOGX_ERR_SUCCESS;
+        break;
+    }
+    pthread_rwlock_unlock(&logger->sinks.lock);
+    pthread_mutex_unlock(&logger->lock);
+
+    return eErr;
+}
+
+logx_errorcodes_t logx_sink_set_level(logx_t *logger, logx_sink_t *sink, logx_level_t level)
+{
+    /* Sanity check */
+    if (!logger || !sink || is_valid_logx_level(level) != LOGX_ERR_SUCCESS)
+        return LOGX_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&sink->level, level, __ATOMIC_RELAXED);
+    sinks_update_floor(&logger->sinks);
+    pthread_mutex_unlock(&logger->lock);
+
+    return LOGX_ERR_SUCCESS;
+}
+
+logx_errorcodes_t logx_flush(logx_t *logger)
+{
+    /* Sanity check */
+    if (!logger)
+        return LOGX_ERR_INVALID_ARG;
+
+    pthread_rwlock_rdlock(&logger->sinks.lock);
+    logx_errorcodes_t eErr = logx_sinks_flush_locked(logger);
+    pthread_rwlock_unlock(&logger->sinks.lock);
+
+    return eErr;
+}
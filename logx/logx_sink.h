@@ -0,0 +1,331 @@
+/**
+ * @file logx_sink.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief Pluggable output sinks — each with its own level, record format and batch buffer.
+ *
+ * Every logger owns a list of sinks. The console, file and syslog outputs are the
+ * three built-in sinks; they follow the logger configuration (`console_level`,
+ * `enable_file_logging`, `enable_colored_logs`, ...). Every setter (the control
+ * socket goes through them) and a config reload copy the new settings into them
+ * with `logx_sinks_sync()`; nothing is re-read per record. Applications add their
+ * own sinks with `logx_add_sink()`.
+ *
+ * A record is rendered at most once per format, however many sinks use that
+ * format. A sink with a non-zero `buffer_size` collects rendered records and
+ * receives them in batches through `write_batch`. A batch is handed over when the
+ * buffer is full, when an ERROR or FATAL record arrives, when the oldest buffered
+ * record is older than `LOGX_SINK_FLUSH_INTERVAL_MS`, and on `logx_flush()`,
+ * rotation and `logx_destroy()`. The age of a batch is checked when the next record
+ * arrives and, so that a quiet program does not hold records back, by a `logx-flush`
+ * thread that a logger starts once it has a buffered sink and that wakes every
+ * `LOGX_SINK_FLUSH_TICK_MS`. The same thread writes the dedup summary of a logger
+ * that went quiet, so a logger with `dedup_window_ms` set starts it as well. A
+ * process forked after that has no such thread; its batches are handed over by the
+ * other triggers.
+ *
+ * A `write_batch` or `flush` callback that fails is counted in
+ * `logx_stats_t::write_errors`; `logx_flush()` also returns the error.
+ *
+ * Each sink has a lock of its own, so a slow sink only holds up records that go
+ * to it. The callbacks of one sink never run concurrently; they run with that
+ * sink's lock held and must not log through the same logger.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_SINK_H
+#define LOGX_SINK_H
+
+#include "logx_errorcodes.h"
+#include "logx_types.h"
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Maximum number of sinks per logger, built-in sinks included. */
+#ifndef LOGX_MAX_SINKS
+#define LOGX_MAX_SINKS 8
+#endif
+
+/** @brief Maximum number of records a sink batches before handing them over. */
+#ifndef LOGX_SINK_BATCH_MAX
+#define LOGX_SINK_BATCH_MAX 64
+#endif
+
+/**
+ * @brief Largest single `write()` the file sink relies on being atomic with
+ *        `file_atomic_append`; longer records are written under the file lock.
+ */
+#ifndef LOGX_ATOMIC_APPEND_MAX
+#define LOGX_ATOMIC_APPEND_MAX 4096
+#endif
+
+/** @brief A buffered record is handed over once it is older than this. */
+#ifndef LOGX_SINK_FLUSH_INTERVAL_MS
+#define LOGX_SINK_FLUSH_INTERVAL_MS 1000
+#endif
+
+/** @brief How often the `logx-flush` thread looks for batches older than the interval. */
+#ifndef LOGX_SINK_FLUSH_TICK_MS
+#define LOGX_SINK_FLUSH_TICK_MS (LOGX_SINK_FLUSH_INTERVAL_MS / 4)
+#endif
+
+/**
+ * @brief How records are rendered for a sink.
+ */
+typedef enum
+{
+    LOGX_SINK_FORMAT_PLAIN = 0, /**< `[ts] [LVL] [name] (file:func:line): message\n` */
+    LOGX_SINK_FORMAT_COLOR,     /**< As `PLAIN`, wrapped in ANSI colour codes by level. */
+    LOGX_SINK_FORMAT_SYSLOG,    /**< `[name] (file:func:line): message`, no timestamp or newline. */
+    LOGX_SINK_FORMAT_COUNT      /**< Number of formats. */
+} logx_sink_format_t;
+
+/**
+ * @brief One rendered record as handed to a sink.
+ */
+typedef struct
+{
+    logx_level_t level; /**< Level of the record. */
+    const char *text;   /**< Rendered record in the sink's format; not NUL-terminated. */
+    size_t len;         /**< Length of `text` in bytes. */
+    uint64_t time_us;   /**< Wall-clock time of the record in microseconds since the epoch. */
+} logx_sink_record_t;
+
+/**
+ * @brief Sink callbacks. Only `write_batch` is required.
+ *
+ * Every callback receives the `ctx` pointer given to `logx_add_sink()`.
+ */
+typedef struct
+{
+    /** Called once from `logx_add_sink()`; a failure rejects the sink. */
+    logx_errorcodes_t (*open)(void *ctx);
+    /** Write `count` records, oldest first. */
+    logx_errorcodes_t (*write_batch)(void *ctx, const logx_sink_record_t *records, size_t count);
+    /** Push anything the sink buffers itself to its destination. */
+    logx_errorcodes_t (*flush)(void *ctx);
+    /** Called once from `logx_remove_sink()` or `logx_destroy()`, after a final flush. */
+    void (*close)(void *ctx);
+} logx_sink_ops_t;
+
+/**
+ * @brief Settings for a sink added with `logx_add_sink()`.
+ */
+typedef struct
+{
+    const char *name;          /**< Sink name for diagnostics (copied). */
+    logx_level_t level;        /**< Minimum level written to this sink. */
+    logx_sink_format_t format; /**< Record format. */
+    size_t buffer_size;        /**< Batch buffer in bytes; 0 hands over every record at once. */
+} logx_sink_cfg_t;
+
+/**
+ * @brief A sink attached to a logger. Obtain via `logx_add_sink()`.
+ *
+ * `enabled`, `level` and `format` are changed under the logger lock and read without
+ * it; the batch is protected by `lock`. Use the API to change them.
+ */
+typedef struct logx_sink_t
+{
+    pthread_mutex_t lock;                          /**< Serializes the batch and callbacks. */
+    char *name;                                    /**< Sink name (owned). */
+    const logx_sink_ops_t *ops;                    /**< Callbacks. */
+    void *ctx;                                     /**< Callback context. */
+    int enabled;                                   /**< 0 = skip this sink. */
+    logx_level_t level;                            /**< Minimum level. */
+    logx_sink_format_t format;                     /**< Record format. */
+    uint32_t required_flags;                       /**< `LOGX_FLAG_*` bits a record needs. */
+    size_t buffer_size;                            /**< Size of `buf`; 0 = unbuffered. */
+    char *buf;                                     /**< Text of the buffered records. */
+    size_t buf_used;                               /**< Bytes used in `buf`. */
+    logx_sink_record_t batch[LOGX_SINK_BATCH_MAX]; /**< Buffered records. */
+    size_t batch_count;                            /**< Number of buffered records. */
+    uint64_t batch_since_ms;                       /**< Wall-clock time of the oldest one. */
+    uint64_t *errors;                              /**< Failed callbacks are counted here. */
+} logx_sink_t;
+
+/** @brief Background thread that hands over batches of a quiet logger (`logx_sink.c`). */
+typedef struct logx_sink_flusher_t logx_sink_flusher_t;
+
+/**
+ * @brief Per-logger sink list embedded in `logx_t`.
+ *
+ * Records are written with `lock` held for reading; sinks are added and removed,
+ * and the configuration is swapped on reload, with it held for writing.
+ */
+typedef struct
+{
+    pthread_rwlock_t lock;             /**< Protects the list against records in flight. */
+    logx_sink_t *list[LOGX_MAX_SINKS]; /**< Attached sinks; the built-in ones come first. */
+    int count;                         /**< Number of attached sinks. */
+    logx_level_t floor;                /**< Lowest level of an enabled sink (OFF = none). */
+    logx_sink_flusher_t *flusher;      /**< Started with the first buffered sink, or NULL. */
+} logx_sink_set_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Attach a sink to a logger.
+     *
+     * @param[in]  logger Pointer to the logger instance.
+     * @param[in]  ops    Callbacks; must stay valid until the sink is removed.
+     * @param[in]  ctx    Context passed to every callback.
+     * @param[in]  cfg    Level, format and buffer size of the sink.
+     * @param[out] out    Receives the sink handle (may be NULL).
+     * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_INVALID_ARG` on bad input or when the
+     *         logger already has `LOGX_MAX_SINKS` sinks, `LOGX_ERR_NO_MEM`, or the
+     *         error returned by `ops->open`.
+     */
+    logx_errorcodes_t logx_add_sink(logx_t *logger, const logx_sink_ops_t *ops, void *ctx,
+                                    const logx_sink_cfg_t *cfg, logx_sink_t **out);
+
+    /**
+     * @brief Flush, close and detach a sink added with `logx_add_sink()`.
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] sink   Sink handle. Built-in sinks cannot be removed.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` if the sink is not attached.
+     */
+    logx_errorcodes_t logx_remove_sink(logx_t *logger, logx_sink_t *sink);
+
+    /**
+     * @brief Change the minimum level of a sink added with `logx_add_sink()`.
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] sink   Sink handle.
+     * @param[in] level  New minimum level.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_sink_set_level(logx_t *logger, logx_sink_t *sink, logx_level_t level);
+
+    /**
+     * @brief Hand every buffered record to its sink and flush all sinks.
+     * @param[in] logger Pointer to the logger instance.
+     * @return `LOGX_ERR_SUCCESS`, `LOGX_ERR_INVALID_ARG` if logger is NULL, or the first
+     *         error returned by a sink callback.
+     */
+    logx_errorcodes_t logx_flush(logx_t *logger);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @brief Internal — attach the console, file and syslog sinks to a new logger.
+ * @internal
+ *
+ * `logger->sinks.lock` must already be initialised.
+ *
+ * @param[in,out] logger Logger instance.
+ * @return `LOGX_ERR_SUCCESS` or `LOGX_ERR_NO_MEM`.
+ */
+logx_errorcodes_t logx_sinks_init(logx_t *logger);
+
+/**
+ * @brief Internal — flush, close and free every sink of a logger.
+ * @internal
+ *
+ * Must be called with the sink list locked for writing. Also stops the
+ * `logx-flush` thread.
+ *
+ * @param[in,out] logger Logger instance.
+ */
+void logx_sinks_destroy(logx_t *logger);
+
+/**
+ * @brief Internal — copy the logger configuration into the built-in sinks.
+ * @internal
+ *
+ * Must be called with the logger lock held, after every change to the settings the
+ * built-in sinks or the `logx-flush` thread follow.
+ *
+ * @param[in,out] logger Logger instance.
+ */
+void logx_sinks_sync(logx_t *logger);
+
+/**
+ * @brief Internal — hand every buffered record over and flush all sinks.
+ * @internal
+ *
+ * Must be called with the sink list locked for reading or writing.
+ *
+ * @param[in,out] logger Logger instance.
+ * @return `LOGX_ERR_SUCCESS`, or the first error returned by a sink callback.
+ */
+logx_errorcodes_t logx_sinks_flush_locked(logx_t *logger);
+
+/**
+ * @brief Internal — lock-free pre-check whether any sink may take a record.
+ * @internal
+ *
+ * Never misses a record that a sink would take, so records failing it need not be
+ * formatted. `logx_sink_accepts()` makes the exact decision.
+ *
+ * @param[in] set    Sink list.
+ * @param[in] level  Record level.
+ * @param[in] flags  `LOGX_FLAG_*` bits of the record.
+ * @param[in] forced Non-zero if the record ignores sink levels.
+ * @return Non-zero if some sink may write the record.
+ */
+int logx_sinks_wanted(const logx_sink_set_t *set, logx_level_t level, uint32_t flags, int forced);
+
+/**
+ * @brief Internal — take the lock of the built-in file sink.
+ * @internal
+ *
+ * The file sink lock also protects `fp`, `fd`, `direct` and `current_date` of the
+ * logger. Safe to call on a logger whose sinks are not set up yet.
+ *
+ * @param[in,out] logger Logger instance.
+ */
+void logx_file_sink_lock(logx_t *logger);
+
+/**
+ * @brief Internal — release the lock taken by `logx_file_sink_lock()`.
+ * @internal
+ * @param[in,out] logger Logger instance.
+ */
+void logx_file_sink_unlock(logx_t *logger);
+
+/**
+ * @brief Internal — hand the records batched in the built-in file sink to the file.
+ * @internal
+ *
+ * Must be called with the file sink lock held.
+ *
+ * @param[in,out] logger Logger instance.
+ * @return `LOGX_ERR_SUCCESS`, or the error of the file sink's `write_batch`.
+ */
+logx_errorcodes_t logx_file_sink_write_pending(logx_t *logger);
+
+/**
+ * @brief Internal — check whether a record qualifies for a sink.
+ * @internal
+ * @return Non-zero if the record should be written to `sink`.
+ */
+static inline int logx_sink_accepts(const logx_sink_t *sink, logx_level_t level, uint32_t flags,
+                                    int forced)
+{
+    return __atomic_load_n(&sink->enabled, __ATOMIC_RELAXED) &&
+           (forced || level >= __atomic_load_n(&sink->level, __ATOMIC_RELAXED)) &&
+           (flags & sink->required_flags) == sink->required_flags;
+}
+
+/**
+ * @brief Internal — give one rendered record to a sink, batching it if the sink is buffered.
+ * @internal
+ *
+ * Takes the sink's lock. Must be called with the sink list locked for reading.
+ *
+ * @param[in,out] sink   Sink instance.
+ * @param[in]     record Rendered record; the text is copied if it is buffered.
+ * @param[in]     now_ms Wall-clock time of the record in milliseconds.
+ */
+void logx_sink_push(logx_sink_t *sink, const logx_sink_record_t *record, uint64_t now_ms);
+
+#endif /* LOGX_SINK_H */
@@ -12,7 +12,7 @@
  * @copyright Copyright (c) 2025
  */
 
-#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE /* RUSAGE_THREAD */
 
 #include "logx.h"
 #include "logx_common.h"
@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/resource.h>
 #include <sys/time.h>
 #include <time.h>
 
@@ -28,7 +29,7 @@ logx_errorcodes_t logx_set_ts_format_to_epoch_s(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_EPOCH_S;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_EPOCH_S, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
@@ -39,7 +40,7 @@ logx_errorcodes_t logx_set_ts_format_to_epoch_ms(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_EPOCH_MS;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_EPOCH_MS, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
@@ -50,7 +51,7 @@ logx_errorcodes_t logx_set_ts_format_to_epoch_us(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_EPOCH_US;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_EPOCH_US, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
@@ -61,7 +62,7 @@ logx_errorcodes_t logx_set_ts_format_to_local(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_LOCAL;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_LOCAL, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
@@ -72,7 +73,7 @@ logx_errorcodes_t logx_set_ts_format_to_utc(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_UTC;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_UTC, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
@@ -83,7 +84,7 @@ logx_errorcodes_t logx_set_ts_format_to_iso8601(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_ISO8601;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_ISO8601, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
@@ -94,13 +95,162 @@ logx_errorcodes_t logx_set_ts_format_to_rfc2822(logx_t *logger)
 {
     if (logger)
     {
-        logger->cfg.ts_format = LOGX_TS_FMT_RFC2822;
+        __atomic_store_n(&logger->cfg.ts_format, LOGX_TS_FMT_RFC2822, __ATOMIC_RELAXED);
         return LOGX_ERR_SUCCESS;
     }
     else
         return LOGX_ERR_INVALID_ARG;
 }
 
+logx_errorcodes_t logx_enable_timer_resource_usage(logx_t *logger)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.timer_resource_usage, 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&logger->lock);
+
+END:
+    return eErr;
+}
+
+logx_errorcodes_t logx_disable_timer_resource_usage(logx_t *logger)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.timer_resource_usage, 0, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&logger->lock);
+
+END:
+    return eErr;
+}
+
+logx_errorcodes_t logx_set_timer_level(logx_t *logger, logx_level_t level)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    /* Sanity check */
+    if (!logger || is_valid_logx_level(level) != LOGX_ERR_SUCCESS)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    __atomic_store_n(&logger->cfg.timer_level, level, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&logger->lock);
+
+END:
+    return eErr;
+}
+
+/**
+ * @brief Per-thread cache of the part of a timestamp that changes once a second.
+ *
+ * The records of a thread almost always fall into the same second as the one
+ * before, so the calendar conversion and `snprintf()` run once per second and
+ * format; the fraction of the second is written digit by digit.
+ */
+typedef struct
+{
+    time_t sec;    /**< Second `head` was formatted for. */
+    int fmt;       /**< Format `head` was formatted in, -1 if empty. */
+    size_t len;    /**< Length of `head`. */
+    char head[48]; /**< Timestamp up to the fraction of the second. */
+} ts_cache_t;
+
+static _Thread_local ts_cache_t tls_ts_cache = {.fmt = -1};
+
+/**
+ * @brief Format the part of a timestamp that does not depend on the fraction of the second.
+ *
+ * @param[out] c                Cache to fill.
+ * @param[in]  sec              Seconds since the epoch.
+ * @param[in]  eTimestampFormat Timestamp format.
+ * @return logx_errorcodes_t LOGX_ERR_SUCCESS on success
+ */
+static logx_errorcodes_t ts_format_head(ts_cache_t *c, time_t sec, logx_ts_fmt_t eTimestampFormat)
+{
+    static const char *days[]   = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    static const char *months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                   "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    logx_errorcodes_t eErr      = LOGX_ERR_SUCCESS;
+    struct tm tm;
+    int n = -1;
+
+    switch (eTimestampFormat)
+    {
+        case LOGX_TS_FMT_EPOCH_S:
+        case LOGX_TS_FMT_EPOCH_MS:
+        case LOGX_TS_FMT_EPOCH_US:
+        {
+            n = snprintf(c->head, sizeof(c->head), "%lld", (long long)sec);
+            break;
+        }
+
+        case LOGX_TS_FMT_LOCAL:
+        {
+            localtime_r(&sec, &tm);
+            n = snprintf(c->head, sizeof(c->head), "%04d-%02d-%02d %02d:%02d:%02d",
+                         tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
+                         tm.tm_sec);
+            break;
+        }
+
+        case LOGX_TS_FMT_UTC:
+        case LOGX_TS_FMT_ISO8601:
+        {
+            gmtime_r(&sec, &tm);
+            n = snprintf(c->head, sizeof(c->head), "%04d-%02d-%02d%c%02d:%02d:%02d",
+                         tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                         eTimestampFormat == LOGX_TS_FMT_ISO8601 ? 'T' : ' ', tm.tm_hour,
+                         tm.tm_min, tm.tm_sec);
+            break;
+        }
+
+        case LOGX_TS_FMT_RFC2822:
+        {
+            gmtime_r(&sec, &tm);
+            n = snprintf(c->head, sizeof(c->head), "%s, %02d %s %04d %02d:%02d:%02d +0000",
+                         days[tm.tm_wday], tm.tm_mday, months[tm.tm_mon], tm.tm_year + 1900,
+                         tm.tm_hour, tm.tm_min, tm.tm_sec);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    if (n < 0 || (size_t)n >= sizeof(c->head))
+    {
+        c->fmt = -1;
+        eErr   = LOGX_ERR_FAILURE;
+        goto END;
+    }
+
+    c->sec = sec;
+    c->fmt = (int)eTimestampFormat;
+    c->len = (size_t)n;
+
+END:
+    return eErr;
+}
+
 /**
  * @brief Get current timestamp
  *
@@ -114,7 +264,13 @@ logx_errorcodes_t get_timestamp(char *pszBuffer, size_t dwBufferLen, struct time
                                 logx_ts_fmt_t eTimestampFormat)
 {
     logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    ts_cache_t *c          = &tls_ts_cache;
     struct timeval ttmp;
+    char frac[16];
+    size_t frac_len = 0;
+    size_t len;
+    int digits;
+    int value;
 
     if (!pszBuffer || dwBufferLen == 0)
     {
@@ -132,76 +288,67 @@ logx_errorcodes_t get_timestamp(char *pszBuffer, size_t dwBufferLen, struct time
     int ms = (int)(tv->tv_usec / 1000);
     int us = (int)(tv->tv_usec);
 
-    switch (eTimestampFormat)
+    /* Epoch milliseconds and microseconds only read as seconds and fraction after 1970 */
+    if (tv->tv_sec <= 0 &&
+        (eTimestampFormat == LOGX_TS_FMT_EPOCH_MS || eTimestampFormat == LOGX_TS_FMT_EPOCH_US))
     {
+        snprintf(pszBuffer, dwBufferLen, "%lld",
+                 eTimestampFormat == LOGX_TS_FMT_EPOCH_MS ? (long long)tv->tv_sec * 1000 + ms
+                                                          : (long long)tv->tv_sec * 1000000 + us);
+        goto END;
+    }
 
-        case LOGX_TS_FMT_EPOCH_S:
+    if (c->fmt != (int)eTimestampFormat || c->sec != tv->tv_sec)
+    {
+        eErr = ts_format_head(c, tv->tv_sec, eTimestampFormat);
+        if (eErr != LOGX_ERR_SUCCESS)
         {
-            snprintf(pszBuffer, dwBufferLen, "%lld", (long long)tv->tv_sec);
-            break;
+            pszBuffer[0] = '\0';
+            goto END;
         }
+    }
 
+    switch (eTimestampFormat)
+    {
         case LOGX_TS_FMT_EPOCH_MS:
-        {
-            snprintf(pszBuffer, dwBufferLen, "%lld", (long long)tv->tv_sec * 1000 + ms);
+            digits = 3;
+            value  = ms;
             break;
-        }
-
         case LOGX_TS_FMT_EPOCH_US:
-        {
-            snprintf(pszBuffer, dwBufferLen, "%lld", (long long)tv->tv_sec * 1000000 + us);
+            digits = 6;
+            value  = us;
             break;
-        }
-
         case LOGX_TS_FMT_LOCAL:
-        {
-            struct tm tm;
-            localtime_r(&tv->tv_sec, &tm);
-            snprintf(pszBuffer, dwBufferLen, "%04d-%02d-%02d %02d:%02d:%02d.%03d",
-                     tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
-                     ms);
-            break;
-        }
-
         case LOGX_TS_FMT_UTC:
-        {
-            struct tm tm;
-            gmtime_r(&tv->tv_sec, &tm);
-            snprintf(pszBuffer, dwBufferLen, "%04d-%02d-%02d %02d:%02d:%02d.%03dZ",
-                     tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
-                     ms);
-            break;
-        }
-
         case LOGX_TS_FMT_ISO8601:
-        {
-            struct tm tm;
-            gmtime_r(&tv->tv_sec, &tm);
-            snprintf(pszBuffer, dwBufferLen, "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
-                     tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
-                     ms);
+            frac[frac_len++] = '.';
+            digits           = 3;
+            value            = ms;
             break;
-        }
-
-        case LOGX_TS_FMT_RFC2822:
-        {
-            static const char *days[]   = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-            static const char *months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
-                                           "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-            struct tm tm;
-            gmtime_r(&tv->tv_sec, &tm);
-            snprintf(pszBuffer, dwBufferLen, "%s, %02d %s %04d %02d:%02d:%02d +0000",
-                     days[tm.tm_wday], tm.tm_mday, months[tm.tm_mon], tm.tm_year + 1900, tm.tm_hour,
-                     tm.tm_min, tm.tm_sec);
+        default:
+            digits = 0;
+            value  = 0;
             break;
-        }
+    }
 
-        default:
-        {
-            pszBuffer[0] = '\0';
-            eErr         = LOGX_ERR_FAILURE;
-        }
+    for (int i = digits; i > 0; i--)
+    {
+        frac[frac_len + (size_t)i - 1] = (char)('0' + value % 10);
+        value /= 10;
     }
+    frac_len += (size_t)digits;
+
+    if (eTimestampFormat == LOGX_TS_FMT_UTC || eTimestampFormat == LOGX_TS_FMT_ISO8601)
+        frac[frac_len++] = 'Z';
+
+    /* Truncated like snprintf() when the buffer is too small */
+    len = c->len < dwBufferLen - 1 ? c->len : dwBufferLen - 1;
+    memcpy(pszBuffer, c->head, len);
+    if (frac_len > dwBufferLen - 1 - len)
+        frac_len = dwBufferLen - 1 - len;
+    memcpy(pszBuffer + len, frac, frac_len);
+    pszBuffer[len + frac_len] = '\0';
+
 END:
     return eErr;
 }
@@ -260,6 +407,77 @@ static uint64_t diff_ns(const struct timespec *a, const struct timespec *b)
     return result + nsec_diff;
 }
 
+/**
+ * @brief Sample the calling thread's CPU time and rusage counters.
+ *
+ * @param[out] u Destination for the sampled counters. Fields that cannot be
+ *               sampled are left at zero.
+ */
+static void sample_thread_usage(logx_timer_usage_t *u)
+{
+    struct timespec cpu;
+    struct rusage ru;
+
+    memset(u, 0, sizeof(*u));
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu) == 0)
+        u->cpu_ns = (uint64_t)cpu.tv_sec * 1000000000ULL + (uint64_t)cpu.tv_nsec;
+
+    if (getrusage(RUSAGE_THREAD, &ru) == 0)
+    {
+        u->nvcsw  = ru.ru_nvcsw;
+        u->nivcsw = ru.ru_nivcsw;
+        u->majflt = ru.ru_majflt;
+        u->minflt = ru.ru_minflt;
+    }
+}
+
+/**
+ * @brief Begin a running segment of a timer — record wall clock and, if enabled, usage.
+ *
+ * @param[in,out] t Timer to start or resume.
+ */
+static void timer_segment_begin(logx_timer_t *t)
+{
+    if (t->track_usage)
+        sample_thread_usage(&t->usage_start);
+
+    clock_gettime(CLOCK_MONOTONIC, &t->start);
+    t->bRunning = 1;
+}
+
+/**
+ * @brief End a running segment of a timer — accumulate wall clock and usage deltas.
+ *
+ * @param[in,out] t Timer to pause or stop. Must be running.
+ */
+static void timer_segment_end(logx_timer_t *t)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    t->accumulated_ns += diff_ns(&now, &t->start);
+    t->bRunning = 0;
+
+    if (t->track_usage)
+    {
+        logx_timer_usage_t end;
+        sample_thread_usage(&end);
+
+        /* Deltas are clamped at zero in case the segment ended on another thread */
+        t->usage.cpu_ns += (end.cpu_ns > t->usage_start.cpu_ns)
+                               ? end.cpu_ns - t->usage_start.cpu_ns
+                               : 0;
+        t->usage.nvcsw += (end.nvcsw > t->usage_start.nvcsw) ? end.nvcsw - t->usage_start.nvcsw : 0;
+        t->usage.nivcsw +=
+            (end.nivcsw > t->usage_start.nivcsw) ? end.nivcsw - t->usage_start.nivcsw : 0;
+        t->usage.majflt +=
+            (end.majflt > t->usage_start.majflt) ? end.majflt - t->usage_start.majflt : 0;
+        t->usage.minflt +=
+            (end.minflt > t->usage_start.minflt) ? end.minflt - t->usage_start.minflt : 0;
+    }
+}
+
 /**
  * @brief Convert a duration in nanoseconds to hours, minutes, seconds, and milliseconds.
  *
@@ -302,19 +520,19 @@ static void format_time(uint64_t ns, int *h, int *m, int *s, int *ms)
  * @param[in] logger Pointer to the logger instance containing timers.
  * @param[in] name   Null-terminated name of the timer to search for.
  *
- * @return Index of the timer in `logger->timers` if found,
+ * @return Index of the timer in `logger->timers.list` if found,
  *         otherwise `-1`.
  *
  * @note The function assumes:
- *       - `logger->timers[i].name` is not NULL.
+ *       - `logger->timers.list[i].name` is not NULL.
  */
 static int find_timer_index(logx_t *logger, const char *name)
 {
     if (!logger || !name)
         return -1;
 
-    for (int i = 0; i < logger->timer_count; i++)
-        if (strcmp(logger->timers[i].name, name) == 0)
+    for (int i = 0; i < logger->timers.count; i++)
+        if (strcmp(logger->timers.list[i].name, name) == 0)
             return i;
 
     return -1;
@@ -325,52 +543,53 @@ logx_timer_t *logx_timer_start(logx_t *logger, const char *name)
     if (!logger || !name)
         return NULL;
 
-    pthread_mutex_lock(&logger->lock);
+    pthread_mutex_lock(&logger->timers.lock);
 
     int idx = find_timer_index(logger, name);
 
     // If timer already exists
     if (idx >= 0)
     {
-        fprintf(stderr, "[LogX] Timer[%s] already exists !\n", logger->timers[idx].name);
-        logx_timer_t *t = &logger->timers[idx];
+        fprintf(stderr, "[LogX] Timer[%s] already exists !\n", logger->timers.list[idx].name);
+        logx_timer_t *t = &logger->timers.list[idx];
 
         if (t->bRunning)
         {
             // Already running
-            pthread_mutex_unlock(&logger->lock);
+            pthread_mutex_unlock(&logger->timers.lock);
             return t;
         }
 
         // Resuming a paused timer
-        clock_gettime(CLOCK_MONOTONIC, &t->start);
-        t->bRunning = true;
+        timer_segment_begin(t);
 
-        pthread_mutex_unlock(&logger->lock);
+        pthread_mutex_unlock(&logger->timers.lock);
         return t;
     }
 
     // Check if Max timer capacity reached
-    if (logger->timer_count >= LOGX_MAX_TIMERS)
+    if (logger->timers.count >= LOGX_MAX_TIMERS)
     {
         // No space – fail silently or log warning
         fprintf(stderr, "[LogX] Max timer capacity reached. Can't create new timer\n");
-        pthread_mutex_unlock(&logger->lock);
+        pthread_mutex_unlock(&logger->timers.lock);
         return NULL;
     }
 
-    logx_timer_t *t = &logger->timers[logger->timer_count++];
+    logx_timer_t *t = &logger->timers.list[logger->timers.count++];
 
     strncpy(t->name, name, LOGX_TIMER_MAX_LEN - 1);
     t->name[LOGX_TIMER_MAX_LEN - 1] = '\0'; // Ensure null-termination
 
-    clock_gettime(CLOCK_MONOTONIC, &t->start);
     t->accumulated_ns = 0;
-    t->bRunning       = 1;
+    t->track_usage    = __atomic_load_n(&logger->cfg.timer_resource_usage, __ATOMIC_RELAXED);
+    memset(&t->usage, 0, sizeof(t->usage));
 
     t->logger = logger;
 
-    pthread_mutex_unlock(&logger->lock);
+    timer_segment_begin(t);
+
+    pthread_mutex_unlock(&logger->timers.lock);
 
     return t;
 }
@@ -380,30 +599,26 @@ void logx_timer_pause(logx_t *logger, const char *name)
     if (!logger || !name)
         return;
 
-    pthread_mutex_lock(&logger->lock);
+    pthread_mutex_lock(&logger->timers.lock);
 
     int idx = find_timer_index(logger, name);
     if (idx < 0)
     {
-        pthread_mutex_unlock(&logger->lock);
+        pthread_mutex_unlock(&logger->timers.lock);
         return;
     }
 
-    logx_timer_t *t = &logger->timers[idx];
+    logx_timer_t *t = &logger->timers.list[idx];
 
     if (!t->bRunning)
     {
-        pthread_mutex_unlock(&logger->lock);
+        pthread_mutex_unlock(&logger->timers.lock);
         return; // Already paused
     }
 
-    struct timespec now;
-    clock_gettime(CLOCK_MONOTONIC, &now);
-
-    t->accumulated_ns += diff_ns(&now, &t->start);
-    t->bRunning = 0;
+    timer_segment_end(t);
 
-    pthread_mutex_unlock(&logger->lock);
+    pthread_mutex_unlock(&logger->timers.lock);
 }
 
 void logx_timer_resume(logx_t *logger, const char *name)
@@ -411,90 +626,98 @@ void logx_timer_resume(logx_t *logger, const char *name)
     if (!logger || !name)
         return;
 
-    pthread_mutex_lock(&logger->lock);
+    pthread_mutex_lock(&logger->timers.lock);
 
     int idx = find_timer_index(logger, name);
     if (idx < 0)
     {
-        pthread_mutex_unlock(&logger->lock);
+        pthread_mutex_unlock(&logger->timers.lock);
         return;
     }
 
-    logx_timer_t *t = &logger->timers[idx];
+    logx_timer_t *t = &logger->timers.list[idx];
 
     if (t->bRunning)
     {
-        fprintf(stderr, "[LogX] Timer[%s] is already running\n", logger->timers[idx].name);
-        pthread_mutex_unlock(&logger->lock);
+        fprintf(stderr, "[LogX] Timer[%s] is already running\n", logger->timers.list[idx].name);
+        pthread_mutex_unlock(&logger->timers.lock);
         return; // Already running
     }
 
-    clock_gettime(CLOCK_MONOTONIC, &t->start);
-    t->bRunning = 1;
+    timer_segment_begin(t);
 
-    pthread_mutex_unlock(&logger->lock);
+    pthread_mutex_unlock(&logger->timers.lock);
 }
 
-void logx_timer_stop(logx_t *logger, const char *name)
+void logx_timer_stop_at(logx_t *logger, const char *name, const char *file, const char *func,
+                        int line)
 {
     if (!logger || !name)
         return;
 
-    pthread_mutex_lock(&logger->lock);
+    pthread_mutex_lock(&logger->timers.lock);
 
     int idx = find_timer_index(logger, name);
     if (idx < 0)
     {
-        pthread_mutex_unlock(&logger->lock);
+        pthread_mutex_unlock(&logger->timers.lock);
         return;
     }
 
-    logx_timer_t *t = &logger->timers[idx];
-    struct timespec now;
+    logx_timer_t *t = &logger->timers.list[idx];
 
     // If running, add the final duration
     if (t->bRunning)
-    {
-        clock_gettime(CLOCK_MONOTONIC, &now);
-        t->accumulated_ns += diff_ns(&now, &t->start);
-    }
+        timer_segment_end(t);
+
+    /* Take a copy of what we report — the slot is recycled below */
+    char timer_name[LOGX_TIMER_MAX_LEN];
+    uint64_t elapsed_ns      = t->accumulated_ns;
+    logx_level_t level       = __atomic_load_n(&logger->cfg.timer_level, __ATOMIC_RELAXED);
+    int track_usage          = t->track_usage;
+    logx_timer_usage_t usage = t->usage;
+    memcpy(timer_name, t->name, sizeof(timer_name));
+
+    // Remove timer by shifting array left
+    /* FIX ME - is array shifting inefficient ? */
+    for (int i = idx; i < logger->timers.count - 1; i++)
+        logger->timers.list[i] = logger->timers.list[i + 1];
+
+    logger->timers.count--;
+
+    pthread_mutex_unlock(&logger->timers.lock);
 
     // Format the elapsed time
     int h, m, s, ms;
-    format_time(t->accumulated_ns, &h, &m, &s, &ms);
+    format_time(elapsed_ns, &h, &m, &s, &ms);
 
-    // Log the time (adjust to your log function)
-    if (logger->cfg.enable_console_logging)
+    /* Emit as an ordinary record so levels, sinks and rotation all apply.
+     * The trailing key=value fields are stable for machine parsing. */
+    if (track_usage)
     {
-        fprintf(stderr, "[LogX] Timer[%s] took %dh:%dm:%ds:%dms\n", t->name, h, m, s, ms);
+        logx_log(logger, level, file, func, line,
+                 "Timer[%s] took %dh:%dm:%ds:%dms (cpu %llu.%03llums) | name=%s elapsed_ns=%llu "
+                 "thread=%lu cpu_ns=%llu vcsw=%ld ivcsw=%ld majflt=%ld minflt=%ld",
+                 timer_name, h, m, s, ms, (unsigned long long)(usage.cpu_ns / 1000000ULL),
+                 (unsigned long long)(usage.cpu_ns / 1000ULL % 1000ULL), timer_name,
+                 (unsigned long long)elapsed_ns, logx_thread_id(),
+                 (unsigned long long)usage.cpu_ns, usage.nvcsw, usage.nivcsw, usage.majflt,
+                 usage.minflt);
     }
-
-    if (logger->cfg.enable_file_logging)
+    else
     {
-        if (logger->fd >= 0)
-            exclusive_flock(logger->fd);
-
-        if (logger->fp)
-        {
-            fprintf(logger->fp, "[LogX] Timer[%s] took %dh:%dm:%ds:%dms\n", t->name, h, m, s, ms);
-            fflush(logger->fp);
-        }
+        logx_log(logger, level, file, func, line,
+                 "Timer[%s] took %dh:%dm:%ds:%dms | name=%s elapsed_ns=%llu thread=%lu",
+                 timer_name, h, m, s, ms, timer_name, (unsigned long long)elapsed_ns,
+                 logx_thread_id());
     }
-
-    // Remove timer by shifting array left
-    /* FIX ME - is array shifting inefficient ? */
-    for (int i = idx; i < logger->timer_count - 1; i++)
-        logger->timers[i] = logger->timers[i + 1];
-
-    logger->timer_count--;
-
-    pthread_mutex_unlock(&logger->lock);
 }
 
-void logx_timer_auto_cleanup(logx_timer_t **t)
+void logx_timer_auto_cleanup(logx_timer_scope_t *scope)
 {
-    if (t && *t && (*t)->logger)
+    if (scope && scope->timer && scope->timer->logger)
     {
-        logx_timer_stop((*t)->logger, (*t)->name);
+        logx_timer_stop_at(scope->timer->logger, scope->timer->name, scope->file, scope->func,
+                           scope->line);
     }
 }
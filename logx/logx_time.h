@@ -12,6 +12,7 @@
 #define LOGX_TIME_H
 
 #include <logx_types.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <sys/time.h>
 
@@ -25,6 +26,22 @@
 #define LOGX_TIMER_MAX_LEN 64
 #endif
 
+/**
+ * @brief Per-thread resource counters sampled by a timer when resource tracking is enabled.
+ *
+ * CPU time comes from `CLOCK_THREAD_CPUTIME_ID`, the remaining counters from
+ * `getrusage(RUSAGE_THREAD)`. All values describe the thread that started/resumed
+ * and paused/stopped the timer.
+ */
+typedef struct
+{
+    uint64_t cpu_ns; /**< Thread CPU time in nanoseconds. */
+    long nvcsw;      /**< Voluntary context switches (blocked / slept). */
+    long nivcsw;     /**< Involuntary context switches (preempted). */
+    long majflt;     /**< Major page faults (required I/O). */
+    long minflt;     /**< Minor page faults (no I/O). */
+} logx_timer_usage_t;
+
 /**
  * @brief Internal stopwatch timer state.
  */
@@ -35,8 +52,34 @@ struct logx_timer_t
     struct timespec start;         /**< Timestamp of the most recent start or resume. */
     uint64_t accumulated_ns;       /**< Total nanoseconds accumulated across pause/resume cycles. */
     int bRunning;                  /**< Non-zero if the timer is currently running. */
+    int track_usage;               /**< Non-zero if CPU / rusage deltas are being captured. */
+    logx_timer_usage_t usage_start; /**< Counters sampled at the most recent start or resume. */
+    logx_timer_usage_t usage;       /**< Counter deltas accumulated across pause/resume cycles. */
 };
 
+/**
+ * @brief Per-logger timer pool embedded in `logx_t`. It has a lock of its own, so
+ *        timer operations never wait for records being written.
+ */
+typedef struct
+{
+    pthread_mutex_t lock;               /**< Protects `list` and `count`. */
+    logx_timer_t list[LOGX_MAX_TIMERS]; /**< Active timers. */
+    int count;                          /**< Number of active timers. */
+} logx_timer_set_t;
+
+/**
+ * @brief Scope guard declared by `LOGX_TIMER_AUTO`.
+ * @internal
+ */
+typedef struct
+{
+    logx_timer_t *timer; /**< Timer started for the scope, or NULL. */
+    const char *file;    /**< Source file of the `LOGX_TIMER_AUTO` line. */
+    const char *func;    /**< Function that contains it. */
+    int line;            /**< Its line number. */
+} logx_timer_scope_t;
+
 /**
  * @brief Cleanup callback used by `LOGX_TIMER_AUTO`.
  * @internal
@@ -44,9 +87,9 @@ struct logx_timer_t
  * Called automatically by the compiler's `__attribute__((cleanup))` extension
  * when the enclosing scope exits.  Do not call directly.
  *
- * @param[in] t Double pointer to the timer to stop.
+ * @param[in] scope Scope guard of the timer to stop.
  */
-void logx_timer_auto_cleanup(logx_timer_t **t);
+void logx_timer_auto_cleanup(logx_timer_scope_t *scope);
 
 /**
  * @brief Declare a scope-scoped timer that stops automatically on function return.
@@ -55,12 +98,15 @@ void logx_timer_auto_cleanup(logx_timer_t **t);
  * `__COUNTER__` ensures the internal variable name is unique even if the macro
  * is used multiple times within the same scope.
  *
+ * The result record points at the `LOGX_TIMER_AUTO` line.
+ *
  * @param logger Pointer to the `logx_t` instance.
  * @param name   String literal or variable holding the timer name.
  */
-#define LOGX_TIMER_AUTO(logger, name)                               \
-    logx_timer_t *__attribute__((cleanup(logx_timer_auto_cleanup))) \
-    __logx_auto_timer_##__COUNTER__ = logx_timer_start(logger, name)
+#define LOGX_TIMER_AUTO(logger, name)                                    \
+    logx_timer_scope_t __attribute__((cleanup(logx_timer_auto_cleanup))) \
+    __logx_auto_timer_##__COUNTER__ = {logx_timer_start(logger, name),   \
+                                       LOGX_FILENAME(__FILE__), __func__, __LINE__}
 
 /**
  * @brief Convert a 64-bit unsigned integer to a grouped binary string.
@@ -97,11 +143,24 @@ extern "C"
 
     /**
      * @brief Stop a running timer, log the elapsed time, and remove it.
+     * @internal
+     *
+     * Do not call this directly. Use `logx_timer_stop()`, which supplies the
+     * caller's `file`, `func` and `line` for the result record.
+     *
+     * The result is emitted as a regular log record at `logx_cfg_t::timer_level`,
+     * so it honours the console/file levels, rotation and syslog like any other
+     * record. The message ends with machine-readable fields:
+     * `name=<timer> elapsed_ns=<u64> thread=<tid>`.
      *
      * @param[in] logger Pointer to the logger instance.
      * @param[in] name   Name of the timer to stop.
+     * @param[in] file   Source file name of the caller (stripped of directory prefix).
+     * @param[in] func   Calling function name.
+     * @param[in] line   Source line number of the caller.
      */
-    void logx_timer_stop(logx_t *logger, const char *name);
+    void logx_timer_stop_at(logx_t *logger, const char *name, const char *file, const char *func,
+                            int line);
 
     /**
      * @brief Pause a running timer, accumulating elapsed time so far.
@@ -119,6 +178,34 @@ extern "C"
      */
     void logx_timer_resume(logx_t *logger, const char *name);
 
+    /**
+     * @brief Capture thread CPU time and `getrusage` deltas in timers started from now on.
+     *
+     * When enabled, the timer result additionally reports `cpu_ns`, voluntary and
+     * involuntary context switches, and major/minor page faults, so a slow scope can
+     * be told apart as on-CPU or blocked.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` if logger is NULL.
+     */
+    logx_errorcodes_t logx_enable_timer_resource_usage(logx_t *logger);
+
+    /**
+     * @brief Stop capturing CPU time and `getrusage` deltas in timers started from now on.
+     * @param[in] logger Pointer to the logger instance.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` if logger is NULL.
+     */
+    logx_errorcodes_t logx_disable_timer_resource_usage(logx_t *logger);
+
+    /**
+     * @brief Set the level at which timer results are logged.
+     *
+     * @param[in] logger Pointer to the logger instance.
+     * @param[in] level  Level used by `logx_timer_stop()` for its result record.
+     * @return `LOGX_ERR_SUCCESS`, or `LOGX_ERR_INVALID_ARG` on bad input.
+     */
+    logx_errorcodes_t logx_set_timer_level(logx_t *logger, logx_level_t level);
+
     /**
      * @brief Set the timestamp format to Unix epoch seconds (`1747384321`).
      * @param[in] logger Pointer to the logger instance.
@@ -172,6 +259,18 @@ extern "C"
 }
 #endif
 
+/**
+ * @brief Stop a running timer, log the elapsed time, and remove it.
+ *
+ * The result record carries the caller's location, like the `LOGX_*` macros.
+ * See `logx_timer_stop_at()`.
+ *
+ * @param logger Pointer to the logger instance.
+ * @param name   Name of the timer to stop.
+ */
+#define logx_timer_stop(logger, name) \
+    logx_timer_stop_at((logger), (name), LOGX_FILENAME(__FILE__), __func__, __LINE__)
+
 /**
  * @brief Internal — format the current time into a buffer according to the given format.
  * @internal
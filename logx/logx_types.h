@@ -27,22 +27,22 @@ typedef struct logx_rotate_cfg_t logx_rotate_cfg_t;
 typedef struct logx_timer_t logx_timer_t;
 
 /**
- * @brief Log severity levels, ordered from lowest to highest.
+ * @brief Log severity levels, ordered from lowest to highest, starting at 0.
  *
- * Pass `LOGX_LEVEL_OFF` to disable logging entirely on a given output.
+ * `LOGX_LEVEL_TRACE`, `DEBUG`, `BANNER`, `INFO`, `WARN`, `ERROR`, `FATAL` and
+ * `OFF`, generated from logx_levels.def. Pass `LOGX_LEVEL_OFF` to disable
+ * logging entirely on a given output.
  */
 typedef enum
 {
-    LOGX_LEVEL_TRACE = 0, /**< Verbose flow tracing; lowest severity. */
-    LOGX_LEVEL_DEBUG,     /**< Developer-only diagnostic information. */
-    LOGX_LEVEL_BANNER,    /**< Milestone banners; auto-centered in output. */
-    LOGX_LEVEL_INFO,      /**< General operational information. */
-    LOGX_LEVEL_WARN,      /**< Non-fatal anomalies that deserve attention. */
-    LOGX_LEVEL_ERROR,     /**< Recoverable errors. */
-    LOGX_LEVEL_FATAL,     /**< Unrecoverable errors; program should terminate. */
-    LOGX_LEVEL_OFF        /**< Disable logging on this output channel. */
+#define LOGX_LEVEL_DEF(name, tag, color, priority) LOGX_LEVEL_##name,
+#include "logx_levels.def"
+#undef LOGX_LEVEL_DEF
 } logx_level_t;
 
+/** @brief Number of log levels, `LOGX_LEVEL_OFF` included. */
+#define LOGX_LEVEL_COUNT (LOGX_LEVEL_OFF + 1)
+
 /**
  * @brief Internal field type tag used by the config parser dispatch table.
  * @internal
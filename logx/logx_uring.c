@@ -0,0 +1,787 @@
+/**
+ * @file logx_uring.c
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief io_uring file sink — write slots, raw ring setup, completion thread and the
+ *        pwrite fallback.
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#define _GNU_SOURCE /* syscall, MAP_POPULATE, pthread_setname_np */
+
+#include "logx_uring.h"
+#include "logx.h"
+#include "logx_common.h"
+#include "logx_rotation.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#if defined(IORING_OFF_SQES) && defined(__NR_io_uring_setup)
+#define LOGX_HAVE_IO_URING 1
+#else
+#define LOGX_HAVE_IO_URING 0
+#endif
+
+/** @brief `user_data` of the NOP that stops the completion thread. */
+#define URING_STOP_TAG UINT64_MAX
+
+/**
+ * @brief One write slot: a registered buffer and the file range it covers.
+ */
+typedef struct
+{
+    off_t off;   /**< File offset of the first byte. */
+    size_t len;  /**< Bytes filled. */
+    size_t done; /**< Bytes already written. */
+    int busy;    /**< 1 while being filled or in flight. */
+} uring_slot_t;
+
+/**
+ * @brief State of one io_uring sink. Owned by the sink once it is attached.
+ */
+typedef struct
+{
+    char *path;      /**< Log file (owned). */
+    int fd;          /**< Open descriptor, or -1. */
+    off_t offset;    /**< Offset of the next byte to be queued. */
+    size_t max_size; /**< Rotation threshold; 0 = never. */
+    int max_backups; /**< Backups kept on rotation. */
+    int compress;    /**< gzip backups on rotation. */
+
+    unsigned depth;      /**< Number of slots. */
+    size_t slot_size;    /**< Bytes per slot. */
+    char *slab;          /**< `depth * slot_size` bytes of slot buffers. */
+    uring_slot_t *slots; /**< Slot bookkeeping. */
+    int cur;             /**< Slot being filled, or -1. */
+    unsigned next;       /**< Slot to fill after `cur`. */
+    unsigned inflight;   /**< Slots submitted and not yet completed. */
+
+    int ring_fd;        /**< io_uring instance, or -1 when writing with pwrite. */
+    int broken;         /**< Completion thread gave up; fall back to pwrite. */
+    int fixed_bufs;     /**< Slots are registered buffers. */
+    int fixed_file;     /**< `fd` is registered as fixed file 0. */
+    void *sq_ring;      /**< Submission ring mapping. */
+    size_t sq_ring_len; /**< Size of `sq_ring`. */
+    void *cq_ring;      /**< Completion ring mapping (may equal `sq_ring`). */
+    size_t cq_ring_len; /**< Size of `cq_ring`. */
+    void *sqes;         /**< Submission queue entries. */
+    size_t sqes_len;    /**< Size of `sqes`. */
+    unsigned *sq_tail;  /**< Submission ring tail. */
+    unsigned *sq_mask;  /**< Submission ring mask. */
+    unsigned *sq_array; /**< Submission ring index array. */
+    unsigned *cq_head;  /**< Completion ring head. */
+    unsigned *cq_tail;  /**< Completion ring tail. */
+    unsigned *cq_mask;  /**< Completion ring mask. */
+    void *cqes;         /**< Completion queue entries. */
+
+    pthread_t thread;      /**< Completion thread. */
+    int thread_started;    /**< 1 once `thread` runs. */
+    pthread_mutex_t lock;  /**< Guards slots, ring submission and `err`. */
+    pthread_cond_t cond;   /**< Signalled whenever a slot completes. */
+    logx_errorcodes_t err; /**< First write error since it was last reported. */
+    int attached;          /**< Set once the sink owns this context. */
+} logx_uring_ctx_t;
+
+/* ── File ────────────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Open the log file and continue at its end.
+ */
+static logx_errorcodes_t uring_open_file(logx_uring_ctx_t *m)
+{
+    ensure_parent_dir_exists(m->path);
+
+    m->fd = open(m->path, O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+    if (m->fd < 0)
+        return LOGX_ERR_FILE_OPEN_FAILED;
+
+    m->offset = lseek(m->fd, 0, SEEK_END);
+    if (m->offset < 0)
+        m->offset = 0;
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Synchronous fallback: write at the current offset with pwrite(2).
+ */
+static logx_errorcodes_t uring_pwrite(logx_uring_ctx_t *m, const char *src, size_t left)
+{
+    while (left > 0)
+    {
+        ssize_t n = pwrite(m->fd, src, left, m->offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return LOGX_ERR_FILE_WRITE_FAILED;
+        m->offset += n;
+        src += n;
+        left -= (size_t)n;
+    }
+    return LOGX_ERR_SUCCESS;
+}
+
+/* ── Ring ────────────────────────────────────────────────────────────────── */
+
+#if LOGX_HAVE_IO_URING
+
+/**
+ * @brief Queue one submission queue entry and hand it to the kernel.
+ *
+ * Called with `m->lock` held. The ring has room for every slot plus the stop
+ * NOP, so the submission queue cannot overflow.
+ */
+static void uring_submit_sqe(logx_uring_ctx_t *m, const struct io_uring_sqe *src)
+{
+    struct io_uring_sqe *sqes = m->sqes;
+    unsigned tail             = *m->sq_tail;
+    unsigned idx              = tail & *m->sq_mask;
+
+    sqes[idx]        = *src;
+    m->sq_array[idx] = idx;
+    __atomic_store_n(m->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    while (syscall(__NR_io_uring_enter, m->ring_fd, 1, 0, 0, NULL, 0) < 0 && errno == EINTR)
+        ;
+}
+
+/**
+ * @brief Submit the unwritten part of a slot. Called with `m->lock` held.
+ */
+static void uring_submit_slot(logx_uring_ctx_t *m, unsigned s)
+{
+    uring_slot_t *slot      = &m->slots[s];
+    struct io_uring_sqe sqe = {0};
+
+    sqe.opcode    = m->fixed_bufs ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    sqe.fd        = m->fixed_file ? 0 : m->fd;
+    sqe.flags     = m->fixed_file ? IOSQE_FIXED_FILE : 0;
+    sqe.addr      = (uint64_t)(uintptr_t)(m->slab + (size_t)s * m->slot_size + slot->done);
+    sqe.len       = (uint32_t)(slot->len - slot->done);
+    sqe.off       = (uint64_t)(slot->off + (off_t)slot->done);
+    sqe.buf_index = (uint16_t)s;
+    sqe.user_data = s;
+
+    uring_submit_sqe(m, &sqe);
+}
+
+/**
+ * @brief Account one completion. Called with `m->lock` held.
+ */
+static void uring_complete(logx_uring_ctx_t *m, unsigned s, int res)
+{
+    uring_slot_t *slot = &m->slots[s];
+
+    if (res == -EAGAIN || res == -EINTR)
+    {
+        uring_submit_slot(m, s);
+        return;
+    }
+    if (res > 0 && slot->done + (size_t)res < slot->len)
+    {
+        slot->done += (size_t)res;
+        uring_submit_slot(m, s);
+        return;
+    }
+    if (res <= 0 && m->err == LOGX_ERR_SUCCESS)
+        m->err = LOGX_ERR_FILE_WRITE_FAILED;
+
+    slot->busy = 0;
+    m->inflight--;
+}
+
+/**
+ * @brief Completion thread: reap completions until the stop NOP arrives.
+ */
+static void *uring_thread(void *arg)
+{
+    logx_uring_ctx_t *m = arg;
+    int stop            = 0;
+
+    while (!stop)
+    {
+        if (syscall(__NR_io_uring_enter, m->ring_fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 &&
+            errno != EINTR)
+        {
+            /* Slots still busy keep their bytes; uring_write_stranded() writes them */
+            pthread_mutex_lock(&m->lock);
+            m->inflight = 0;
+            m->broken   = 1;
+            m->err      = LOGX_ERR_FILE_WRITE_FAILED;
+            pthread_cond_broadcast(&m->cond);
+            pthread_mutex_unlock(&m->lock);
+            break;
+        }
+
+        pthread_mutex_lock(&m->lock);
+        const struct io_uring_cqe *cqes = m->cqes;
+        unsigned head                   = *m->cq_head;
+        while (head != __atomic_load_n(m->cq_tail, __ATOMIC_ACQUIRE))
+        {
+            const struct io_uring_cqe *cqe = &cqes[head & *m->cq_mask];
+            if (cqe->user_data == URING_STOP_TAG)
+                stop = 1;
+            else
+                uring_complete(m, (unsigned)cqe->user_data, cqe->res);
+            head++;
+        }
+        __atomic_store_n(m->cq_head, head, __ATOMIC_RELEASE);
+        pthread_cond_broadcast(&m->cond);
+        pthread_mutex_unlock(&m->lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Register the log file as fixed file 0; falls back to the plain descriptor.
+ */
+static void uring_register_file(logx_uring_ctx_t *m)
+{
+    m->fixed_file =
+        syscall(__NR_io_uring_register, m->ring_fd, IORING_REGISTER_FILES, &m->fd, 1) == 0;
+}
+
+/**
+ * @brief Drop the fixed file registration before the descriptor is closed.
+ */
+static void uring_unregister_file(logx_uring_ctx_t *m)
+{
+    if (m->fixed_file)
+        syscall(__NR_io_uring_register, m->ring_fd, IORING_UNREGISTER_FILES, NULL, 0);
+    m->fixed_file = 0;
+}
+
+/**
+ * @brief Unmap and close the ring.
+ */
+static void uring_ring_free(logx_uring_ctx_t *m)
+{
+    if (m->sqes)
+        munmap(m->sqes, m->sqes_len);
+    if (m->cq_ring && m->cq_ring != m->sq_ring)
+        munmap(m->cq_ring, m->cq_ring_len);
+    if (m->sq_ring)
+        munmap(m->sq_ring, m->sq_ring_len);
+    if (m->ring_fd >= 0)
+        close(m->ring_fd);
+    m->sqes    = NULL;
+    m->cq_ring = NULL;
+    m->sq_ring = NULL;
+    m->ring_fd = -1;
+}
+
+/**
+ * @brief Set up the ring, register the slots and the file, and start the thread.
+ * @return 0, or a positive errno value if io_uring cannot be used.
+ */
+static int uring_ring_init(logx_uring_ctx_t *m)
+{
+    struct io_uring_params p = {0};
+    struct iovec *iov        = NULL;
+    int rc                   = 0;
+
+    m->ring_fd = (int)syscall(__NR_io_uring_setup, m->depth + 1, &p);
+    if (m->ring_fd < 0)
+    {
+        rc         = errno;
+        m->ring_fd = -1;
+        return rc;
+    }
+
+    m->sq_ring_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    m->cq_ring_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (m->cq_ring_len > m->sq_ring_len)
+            m->sq_ring_len = m->cq_ring_len;
+        m->cq_ring_len = m->sq_ring_len;
+    }
+
+    m->sq_ring = mmap(NULL, m->sq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      m->ring_fd, IORING_OFF_SQ_RING);
+    if (m->sq_ring == MAP_FAILED)
+    {
+        m->sq_ring = NULL;
+        rc         = errno;
+        goto END;
+    }
+
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        m->cq_ring = m->sq_ring;
+    else
+        m->cq_ring = mmap(NULL, m->cq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          m->ring_fd, IORING_OFF_CQ_RING);
+    if (m->cq_ring == MAP_FAILED)
+    {
+        m->cq_ring = NULL;
+        rc         = errno;
+        goto END;
+    }
+
+    m->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    m->sqes     = mmap(NULL, m->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       m->ring_fd, IORING_OFF_SQES);
+    if (m->sqes == MAP_FAILED)
+    {
+        m->sqes = NULL;
+        rc      = errno;
+        goto END;
+    }
+
+    m->sq_tail  = (unsigned *)((char *)m->sq_ring + p.sq_off.tail);
+    m->sq_mask  = (unsigned *)((char *)m->sq_ring + p.sq_off.ring_mask);
+    m->sq_array = (unsigned *)((char *)m->sq_ring + p.sq_off.array);
+    m->cq_head  = (unsigned *)((char *)m->cq_ring + p.cq_off.head);
+    m->cq_tail  = (unsigned *)((char *)m->cq_ring + p.cq_off.tail);
+    m->cq_mask  = (unsigned *)((char *)m->cq_ring + p.cq_off.ring_mask);
+    m->cqes     = (char *)m->cq_ring + p.cq_off.cqes;
+
+    /* Registered buffers and files save a page pin and a file lookup per write;
+     * without them (e.g. RLIMIT_MEMLOCK) the plain opcodes are used */
+    iov = calloc(m->depth, sizeof(*iov));
+    if (iov)
+    {
+        for (unsigned i = 0; i < m->depth; i++)
+        {
+            iov[i].iov_base = m->slab + (size_t)i * m->slot_size;
+            iov[i].iov_len  = m->slot_size;
+        }
+        m->fixed_bufs = syscall(__NR_io_uring_register, m->ring_fd, IORING_REGISTER_BUFFERS, iov,
+                                m->depth) == 0;
+        free(iov);
+    }
+    uring_register_file(m);
+
+    if (pthread_create(&m->thread, NULL, uring_thread, m) != 0)
+    {
+        rc = EAGAIN;
+        goto END;
+    }
+    pthread_setname_np(m->thread, "logx-uring");
+    m->thread_started = 1;
+
+END:
+    if (rc != 0)
+        uring_ring_free(m);
+    return rc;
+}
+
+/**
+ * @brief Stop the completion thread. Called without `m->lock` once nothing is in flight.
+ */
+static void uring_thread_stop(logx_uring_ctx_t *m)
+{
+    struct io_uring_sqe sqe = {0};
+
+    if (!m->thread_started)
+        return;
+
+    sqe.opcode    = IORING_OP_NOP;
+    sqe.user_data = URING_STOP_TAG;
+
+    pthread_mutex_lock(&m->lock);
+    if (!m->broken)
+        uring_submit_sqe(m, &sqe);
+    pthread_mutex_unlock(&m->lock);
+
+    pthread_join(m->thread, NULL);
+    m->thread_started = 0;
+}
+
+#else /* !LOGX_HAVE_IO_URING */
+
+static void uring_submit_slot(logx_uring_ctx_t *m, unsigned s)
+{
+    (void)m;
+    (void)s;
+}
+
+static void uring_register_file(logx_uring_ctx_t *m)
+{
+    (void)m;
+}
+
+static void uring_unregister_file(logx_uring_ctx_t *m)
+{
+    (void)m;
+}
+
+static void uring_ring_free(logx_uring_ctx_t *m)
+{
+    (void)m;
+}
+
+static int uring_ring_init(logx_uring_ctx_t *m)
+{
+    (void)m;
+    return ENOSYS;
+}
+
+static void uring_thread_stop(logx_uring_ctx_t *m)
+{
+    (void)m;
+}
+
+#endif /* LOGX_HAVE_IO_URING */
+
+/* ── Slots ───────────────────────────────────────────────────────────────── */
+
+/** @brief Whether writes go through the ring. Called with `m->lock` held. */
+static int uring_async(const logx_uring_ctx_t *m)
+{
+    return m->ring_fd >= 0 && !m->broken;
+}
+
+/**
+ * @brief Submit the slot being filled, if any. Called with `m->lock` held.
+ */
+static void uring_submit_current(logx_uring_ctx_t *m)
+{
+    if (m->cur < 0)
+        return;
+
+    if (m->slots[m->cur].len > 0)
+    {
+        m->inflight++;
+        uring_submit_slot(m, (unsigned)m->cur);
+    }
+    else
+    {
+        m->slots[m->cur].busy = 0;
+    }
+    m->cur = -1;
+}
+
+/**
+ * @brief Write the slots the ring left behind with pwrite(2), oldest first.
+ *
+ * Once the completion thread gives up, the slot being filled and the writes it
+ * never reaped still hold their bytes. They go to their own offsets, so the file
+ * has no hole where they belong. A slot stays busy until it is fully written.
+ * Called with `m->lock` held.
+ */
+static logx_errorcodes_t uring_write_stranded(logx_uring_ctx_t *m)
+{
+    for (unsigned k = 0; k < m->depth; k++)
+    {
+        unsigned s         = (m->next + k) % m->depth;
+        uring_slot_t *slot = &m->slots[s];
+
+        if (!slot->busy)
+            continue;
+
+        while (slot->done < slot->len)
+        {
+            ssize_t n = pwrite(m->fd, m->slab + (size_t)s * m->slot_size + slot->done,
+                               slot->len - slot->done, slot->off + (off_t)slot->done);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return LOGX_ERR_FILE_WRITE_FAILED;
+            slot->done += (size_t)n;
+        }
+
+        slot->busy = 0;
+        if ((int)s == m->cur)
+            m->cur = -1;
+    }
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Submit the current slot and wait for every write to complete.
+ *
+ * Called with `m->lock` held.
+ */
+static logx_errorcodes_t uring_drain(logx_uring_ctx_t *m)
+{
+    if (uring_async(m))
+    {
+        uring_submit_current(m);
+        while (m->inflight > 0 && !m->broken)
+            pthread_cond_wait(&m->cond, &m->lock);
+    }
+    return uring_write_stranded(m);
+}
+
+/**
+ * @brief Copy bytes into the slots, submitting each one as it fills up.
+ *
+ * Called with `m->lock` held.
+ */
+static logx_errorcodes_t uring_append(logx_uring_ctx_t *m, const char *src, size_t left)
+{
+    while (left > 0)
+    {
+        if (!uring_async(m))
+        {
+            if (uring_write_stranded(m) != LOGX_ERR_SUCCESS)
+                return LOGX_ERR_FILE_WRITE_FAILED;
+            return uring_pwrite(m, src, left);
+        }
+
+        if (m->cur < 0)
+        {
+            unsigned s = m->next;
+            while (m->slots[s].busy && !m->broken)
+                pthread_cond_wait(&m->cond, &m->lock);
+            if (m->broken)
+                continue;
+
+            m->next          = (s + 1) % m->depth;
+            m->cur           = (int)s;
+            m->slots[s].busy = 1;
+            m->slots[s].len  = 0;
+            m->slots[s].done = 0;
+            m->slots[s].off  = m->offset;
+        }
+
+        uring_slot_t *slot = &m->slots[m->cur];
+        size_t room        = m->slot_size - slot->len;
+        size_t n           = left < room ? left : room;
+
+        memcpy(m->slab + (size_t)m->cur * m->slot_size + slot->len, src, n);
+        slot->len += n;
+        m->offset += (off_t)n;
+        src += n;
+        left -= n;
+
+        if (slot->len == m->slot_size)
+            uring_submit_current(m);
+    }
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Open the log file again after a failed reopen, without rotating.
+ *
+ * Called with `m->lock` held.
+ */
+static logx_errorcodes_t uring_reopen(logx_uring_ctx_t *m)
+{
+    if (uring_open_file(m) != LOGX_ERR_SUCCESS)
+        return LOGX_ERR_FILE_WRITE_FAILED;
+    if (m->ring_fd >= 0)
+        uring_register_file(m);
+    return LOGX_ERR_SUCCESS;
+}
+
+/**
+ * @brief Wait for pending writes, rotate the file and start a new one.
+ *
+ * Nothing is rotated while queued bytes cannot be written. If the new file
+ * cannot be opened, `fd` stays -1 and later batches only retry the open.
+ * Called with `m->lock` held.
+ */
+static logx_errorcodes_t uring_rotate(logx_uring_ctx_t *m)
+{
+    if (uring_drain(m) != LOGX_ERR_SUCCESS)
+        return LOGX_ERR_FILE_WRITE_FAILED;
+
+    if (m->ring_fd >= 0)
+        uring_unregister_file(m);
+    close(m->fd);
+    m->fd = -1;
+
+    logx_rotate_files(m->path, m->max_backups, m->compress, 0);
+
+    return uring_reopen(m);
+}
+
+/* ── Sink callbacks ──────────────────────────────────────────────────────── */
+
+/**
+ * @brief Queue a batch of records; the batch ends up in as few writes as possible.
+ */
+static logx_errorcodes_t uring_write_batch(void *ctx, const logx_sink_record_t *records,
+                                           size_t count)
+{
+    logx_uring_ctx_t *m    = ctx;
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_lock(&m->lock);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (m->fd < 0 && uring_reopen(m) != LOGX_ERR_SUCCESS)
+        {
+            eErr = LOGX_ERR_FILE_WRITE_FAILED;
+            break;
+        }
+
+        if (m->max_size && m->offset > 0 && (size_t)m->offset + records[i].len > m->max_size &&
+            uring_rotate(m) != LOGX_ERR_SUCCESS)
+        {
+            eErr = LOGX_ERR_FILE_WRITE_FAILED;
+            break;
+        }
+
+        if (uring_append(m, records[i].text, records[i].len) != LOGX_ERR_SUCCESS)
+            eErr = LOGX_ERR_FILE_WRITE_FAILED;
+    }
+
+    if (uring_async(m))
+        uring_submit_current(m);
+
+    /* Report write errors from the completion thread once */
+    if (eErr == LOGX_ERR_SUCCESS)
+        eErr = m->err;
+    m->err = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_unlock(&m->lock);
+    return eErr;
+}
+
+/**
+ * @brief Wait until every queued write has completed.
+ */
+static logx_errorcodes_t uring_flush(void *ctx)
+{
+    logx_uring_ctx_t *m    = ctx;
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+
+    pthread_mutex_lock(&m->lock);
+    eErr = uring_drain(m);
+    if (eErr == LOGX_ERR_SUCCESS)
+        eErr = m->err;
+    m->err = LOGX_ERR_SUCCESS;
+    pthread_mutex_unlock(&m->lock);
+
+    return eErr;
+}
+
+/**
+ * @brief Release everything; the context itself is freed by the caller.
+ */
+static void uring_release(logx_uring_ctx_t *m)
+{
+    pthread_mutex_lock(&m->lock);
+    if (m->slots && uring_drain(m) != LOGX_ERR_SUCCESS)
+        fprintf(stderr, "[LogX] Failed to write the end of %s\n", m->path);
+    pthread_mutex_unlock(&m->lock);
+
+    uring_thread_stop(m);
+    if (m->ring_fd >= 0)
+        uring_unregister_file(m);
+    uring_ring_free(m);
+
+    if (m->fd >= 0)
+        close(m->fd);
+    m->fd = -1;
+
+    pthread_cond_destroy(&m->cond);
+    pthread_mutex_destroy(&m->lock);
+    free(m->slots);
+    free(m->slab);
+    free(m->path);
+}
+
+/**
+ * @brief Drain and close; frees the context once the sink owns it.
+ */
+static void uring_sink_close(void *ctx)
+{
+    logx_uring_ctx_t *m = ctx;
+
+    if (!m->attached)
+        return;
+    uring_release(m);
+    free(m);
+}
+
+static const logx_sink_ops_t g_uring_ops = {.write_batch = uring_write_batch,
+                                            .flush       = uring_flush,
+                                            .close       = uring_sink_close};
+
+logx_errorcodes_t logx_add_uring_sink(logx_t *logger, const logx_uring_sink_cfg_t *cfg,
+                                      logx_sink_t **out)
+{
+    logx_errorcodes_t eErr = LOGX_ERR_SUCCESS;
+    logx_uring_ctx_t *m    = NULL;
+    logx_sink_t *sink      = NULL;
+    int rc                 = 0;
+
+    /* Sanity check */
+    if (!logger || !cfg || !cfg->path || !*cfg->path ||
+        cfg->queue_depth > LOGX_URING_MAX_DEPTH || cfg->slot_size > UINT32_MAX)
+    {
+        eErr = LOGX_ERR_INVALID_ARG;
+        goto END;
+    }
+
+    m = calloc(1, sizeof(*m));
+    if (!m)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+    m->fd          = -1;
+    m->ring_fd     = -1;
+    m->cur         = -1;
+    m->max_size    = cfg->max_size;
+    m->max_backups = cfg->max_backups;
+    m->compress    = cfg->compress;
+    m->depth       = cfg->queue_depth ? cfg->queue_depth : LOGX_URING_DEFAULT_DEPTH;
+    m->slot_size   = cfg->slot_size ? cfg->slot_size : LOGX_URING_DEFAULT_SLOT_SIZE;
+    pthread_mutex_init(&m->lock, NULL);
+    pthread_cond_init(&m->cond, NULL);
+
+    m->path  = strdup(cfg->path);
+    m->slots = calloc(m->depth, sizeof(*m->slots));
+    if (!m->path || !m->slots ||
+        posix_memalign((void **)&m->slab, (size_t)sysconf(_SC_PAGESIZE),
+                       (size_t)m->depth * m->slot_size) != 0)
+    {
+        eErr = LOGX_ERR_NO_MEM;
+        goto END;
+    }
+
+    if ((eErr = uring_open_file(m)) != LOGX_ERR_SUCCESS)
+        goto END;
+
+    rc = uring_ring_init(m);
+    if (rc != 0)
+        fprintf(stderr, "[LogX] io_uring unavailable (%s), writing %s with pwrite\n",
+                strerror(rc), m->path);
+
+    /* The sink batch buffer matches a slot, so one batch is usually one write */
+    logx_sink_cfg_t scfg = {.name        = "io_uring",
+                            .level       = cfg->level,
+                            .format      = LOGX_SINK_FORMAT_PLAIN,
+                            .buffer_size = m->slot_size};
+
+    if ((eErr = logx_add_sink(logger, &g_uring_ops, m, &scfg, &sink)) != LOGX_ERR_SUCCESS)
+        goto END;
+
+    pthread_mutex_lock(&logger->lock);
+    m->attached = 1;
+    pthread_mutex_unlock(&logger->lock);
+    m = NULL;
+
+END:
+    if (m)
+    {
+        uring_release(m);
+        free(m);
+    }
+    if (out)
+        *out = sink;
+    return eErr;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file logx_uring.h
+ * @author Kulasekaran (kulasekaranslrk@gmail.com)
+ * @brief io_uring file sink — log file writes are queued to the kernel and completed
+ *        asynchronously, so the logging thread never blocks on the disk.
+ *
+ * The sink owns a set of `queue_depth` write slots of `slot_size` bytes each.
+ * Records are copied into the current slot; a full slot (or the end of a batch)
+ * is submitted as one write at an explicit file offset, and the next slot is
+ * filled while it is in flight. A writer thread (`logx-uring`) reaps the
+ * completions, resubmits short writes and hands the slots back. A logging
+ * thread only waits when every slot is still in flight.
+ *
+ * The slots are registered with the ring as fixed buffers and the log file as a
+ * fixed file. The ring is driven through the raw `io_uring_setup` /
+ * `io_uring_enter` / `io_uring_register` system calls; liburing is not needed.
+ * If the kernel has no io_uring, or it is blocked (seccomp, container policy),
+ * the sink says so once on stderr and writes synchronously with `pwrite(2)`.
+ *
+ * Because several writes are in flight at once, a crash can leave a hole of NUL
+ * bytes before the last records that reached the disk. The file must not be
+ * written by anyone else while the sink is open. The sink rotates on its own
+ * `max_size`; `logx_rotate_now()` only applies to the built-in file sink.
+ *
+ * @version 2.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef LOGX_URING_H
+#define LOGX_URING_H
+
+#include "logx_errorcodes.h"
+#include "logx_sink.h"
+#include "logx_types.h"
+#include <stddef.h>
+
+/** @brief Default number of write slots (writes in flight) of the io_uring sink. */
+#ifndef LOGX_URING_DEFAULT_DEPTH
+#define LOGX_URING_DEFAULT_DEPTH 8
+#endif
+
+/** @brief Largest number of write slots accepted by the io_uring sink. */
+#ifndef LOGX_URING_MAX_DEPTH
+#define LOGX_URING_MAX_DEPTH 256
+#endif
+
+/** @brief Default size of one write slot of the io_uring sink in bytes. */
+#ifndef LOGX_URING_DEFAULT_SLOT_SIZE
+#define LOGX_URING_DEFAULT_SLOT_SIZE (64u * 1024u)
+#endif
+
+/**
+ * @brief Settings for `logx_add_uring_sink()`.
+ */
+typedef struct
+{
+    const char *path;     /**< Log file to append to (copied). */
+    logx_level_t level;   /**< Minimum level written to this sink. */
+    unsigned queue_depth; /**< Write slots; 0 = `LOGX_URING_DEFAULT_DEPTH`. */
+    size_t slot_size;     /**< Bytes per slot; 0 = `LOGX_URING_DEFAULT_SLOT_SIZE`. */
+    size_t max_size;      /**< Rotate once the file reaches this size; 0 = never. */
+    int max_backups;      /**< Backups kept on rotation (0 = truncate, no backup). */
+    int compress;         /**< 1 = gzip backups on rotation. */
+} logx_uring_sink_cfg_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Attach an io_uring file sink to a logger.
+     *
+     * Records are written in the plain file format. `logx_flush()` waits until
+     * every queued write has completed. The sink is removed with
+     * `logx_remove_sink()` or on `logx_destroy()`.
+     *
+     * @param[in]  logger Pointer to the logger instance.
+     * @param[in]  cfg    Path, level, queue and rotation settings.
+     * @param[out] out    Receives the sink handle (may be NULL).
+     * @return `LOGX_ERR_SUCCESS` (also when falling back to `pwrite`),
+     *         `LOGX_ERR_INVALID_ARG` on bad input, `LOGX_ERR_NO_MEM`, or
+     *         `LOGX_ERR_FILE_OPEN_FAILED` if the file cannot be opened.
+     */
+    logx_errorcodes_t logx_add_uring_sink(logx_t *logger, const logx_uring_sink_cfg_t *cfg,
+                                          logx_sink_t **out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGX_URING_H */